@@ -0,0 +1,56 @@
+#include "alloc_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+using lx::core::usize;
+
+namespace {
+
+    thread_local usize allocations = 0;
+
+    auto allocate(std::size_t size, std::size_t align) noexcept -> void* {
+
+        allocations += 1;
+
+        // aligned_alloc() requires a size that is a non-zero multiple of the
+        // alignment
+        auto rounded = ((size == 0 ? 1 : size) + align - 1) & ~(align - 1);
+        auto* ptr = std::aligned_alloc(align, rounded);
+
+        if (ptr == nullptr) [[unlikely]]
+            std::abort();
+
+        return ptr;
+    }
+
+}; // namespace
+
+auto lx::bench::allocation_count() noexcept -> usize {
+    return allocations;
+}
+
+auto operator new(std::size_t size) -> void* {
+    return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+auto operator new(std::size_t size, std::align_val_t align) -> void* {
+    return allocate(size, static_cast<std::size_t>(align));
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void {
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::align_val_t) noexcept -> void {
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+    -> void {
+    std::free(ptr);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "lastix/core/number.hpp"
+
+namespace lx::bench {
+
+    /**
+     * @brief Number of global operator new calls made by the calling thread.
+     *
+     * lastix-bench replaces the global allocation functions, so the count
+     * covers every `new` issued by lastix and by the std types compared
+     * against it.
+     */
+    auto allocation_count() noexcept -> lx::core::usize;
+
+}; // namespace lx::bench
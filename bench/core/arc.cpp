@@ -0,0 +1,184 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/arc.hpp"
+#include "alloc_counter.hpp"
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+using namespace lx::core;
+
+namespace {
+
+    struct Payload {
+            u64 a = 0;
+            u64 b = 0;
+    };
+
+    auto report_allocations(benchmark::State& state, usize before) -> void {
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(lx::bench::allocation_count() - before),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    // Fused layout: control block and payload in one allocation
+    auto arc_construct_destroy_inplace(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto arc = Arc<Payload>(u64{1}, u64{2});
+            benchmark::DoNotOptimize(arc.unsafe_get());
+        }
+
+        report_allocations(state, before);
+    }
+
+    // Split layout: what every Arc used before the fused layout existed
+    auto arc_construct_destroy_split(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto arc = Arc<Payload>::unsafe_from_raw(new Payload(1, 2));
+            benchmark::DoNotOptimize(arc.unsafe_get());
+        }
+
+        report_allocations(state, before);
+    }
+
+    // Baseline: make_shared also fuses the control block and the payload
+    auto shared_ptr_construct_destroy(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto ptr = std::make_shared<Payload>(u64{1}, u64{2});
+            benchmark::DoNotOptimize(ptr.get());
+        }
+
+        report_allocations(state, before);
+    }
+
+    // Control blocks recycled by a pool: no global heap traffic at all
+    auto arc_construct_destroy_pool(benchmark::State& state) -> void {
+        auto pool = std::pmr::unsynchronized_pool_resource();
+        auto alloc = std::pmr::polymorphic_allocator<std::byte>(&pool);
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto arc = Arc<Payload>::new_in(alloc, u64{1}, u64{2});
+            benchmark::DoNotOptimize(arc.unsafe_get());
+        }
+
+        report_allocations(state, before);
+    }
+
+    // Construct, read through the handle and drop: the fused layout keeps the
+    // payload next to the counts
+    auto arc_construct_read_inplace(benchmark::State& state) -> void {
+        for (auto _ : state) {
+            auto arc = Arc<Payload>(u64{1}, u64{2});
+            benchmark::DoNotOptimize(arc->a + arc->b);
+        }
+    }
+
+    auto arc_construct_read_split(benchmark::State& state) -> void {
+        for (auto _ : state) {
+            auto arc = Arc<Payload>::unsafe_from_raw(new Payload(1, 2));
+            benchmark::DoNotOptimize(arc->a + arc->b);
+        }
+    }
+
+    // Every thread clones and drops the same Arc, so all refcount traffic
+    // lands on one cache line
+    auto arc_clone_drop_shared(benchmark::State& state) -> void {
+        static auto shared = Arc<Payload>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            auto copy = shared;
+            benchmark::DoNotOptimize(copy.unsafe_get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Each thread clones its own Arc: the cost of the atomic RMWs without
+    // cache line transfers
+    auto arc_clone_drop_local(benchmark::State& state) -> void {
+        auto local = Arc<Payload>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            auto copy = local;
+            benchmark::DoNotOptimize(copy.unsafe_get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    auto shared_ptr_clone_drop_shared(benchmark::State& state) -> void {
+        static auto shared = std::make_shared<Payload>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            auto copy = shared;
+            benchmark::DoNotOptimize(copy.get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    auto shared_ptr_clone_drop_local(benchmark::State& state) -> void {
+        auto local = std::make_shared<Payload>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            auto copy = local;
+            benchmark::DoNotOptimize(copy.get());
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    constexpr auto response_bytes = usize{512};
+
+    // A cached response shared as Arc<u8[]>: one allocation, one pointer
+    // from the handle to the bytes
+    auto arc_slice_share(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto bytes = Arc<u8[]>::from_fn(
+                response_bytes, [](usize i) { return static_cast<u8>(i); });
+            auto reader = bytes;
+            benchmark::DoNotOptimize(reader[response_bytes - 1]);
+        }
+
+        report_allocations(state, before);
+    }
+
+    // The same through shared_ptr<vector>: two allocations and two hops
+    auto shared_ptr_vector_share(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto bytes = std::make_shared<std::vector<u8>>(response_bytes);
+            for (auto i = usize{0}; i < response_bytes; i++)
+                (*bytes)[i] = static_cast<u8>(i);
+
+            auto reader = bytes;
+            benchmark::DoNotOptimize((*reader)[response_bytes - 1]);
+        }
+
+        report_allocations(state, before);
+    }
+
+}; // namespace
+
+BENCHMARK(arc_construct_destroy_inplace);
+BENCHMARK(arc_construct_destroy_split);
+BENCHMARK(shared_ptr_construct_destroy);
+BENCHMARK(arc_construct_destroy_pool);
+BENCHMARK(arc_construct_read_inplace);
+BENCHMARK(arc_construct_read_split);
+BENCHMARK(arc_clone_drop_shared)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(arc_clone_drop_local)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(shared_ptr_clone_drop_shared)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(shared_ptr_clone_drop_local)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(arc_slice_share);
+BENCHMARK(shared_ptr_vector_share);
@@ -0,0 +1,67 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/arena.hpp"
+#include "lastix/core/box.hpp"
+#include "alloc_counter.hpp"
+
+#include <vector>
+
+using namespace lx::core;
+
+namespace {
+
+    struct Node {
+            u64 key = 0;
+            u64 value = 0;
+            Node* next = nullptr;
+    };
+
+    // Objects a request handler creates before it answers
+    constexpr auto objects_per_request = 256;
+
+    auto report_allocations(benchmark::State& state, usize before) -> void {
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(lx::bench::allocation_count() - before),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    // Every object is a separate new and delete
+    auto request_objects_heap(benchmark::State& state) -> void {
+        auto objects = std::vector<Box<Node>>();
+        objects.reserve(objects_per_request);
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            for (auto i = 0; i < objects_per_request; i++)
+                objects.emplace_back(u64{1}, u64{2}, nullptr);
+
+            benchmark::DoNotOptimize(objects.data());
+            objects.clear();
+        }
+
+        report_allocations(state, before);
+    }
+
+    // The same objects bumped out of an arena that is reset per request
+    auto request_objects_arena(benchmark::State& state) -> void {
+        auto arena = Arena();
+        auto objects = std::vector<Node*>();
+        objects.reserve(objects_per_request);
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            for (auto i = 0; i < objects_per_request; i++)
+                objects.push_back(
+                    arena.create<Node>(u64{1}, u64{2}, nullptr).unwrap());
+
+            benchmark::DoNotOptimize(objects.data());
+            objects.clear();
+            arena.reset();
+        }
+
+        report_allocations(state, before);
+    }
+
+}; // namespace
+
+BENCHMARK(request_objects_heap);
+BENCHMARK(request_objects_arena);
@@ -0,0 +1,98 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/atomic_arc.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+using namespace lx::core;
+
+namespace {
+
+    struct Config {
+            u64 version = 0;
+            u64 limit = 0;
+    };
+
+    // Readers only: every thread loads a snapshot and reads from it
+    auto atomic_arc_load(benchmark::State& state) -> void {
+        static auto slot = AtomicArc(Arc<Config>(u64{1}, u64{2}));
+
+        for (auto _ : state) {
+            auto snapshot = slot.load();
+            benchmark::DoNotOptimize(snapshot->limit);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Thread 0 keeps publishing new snapshots while the others read
+    auto atomic_arc_load_store(benchmark::State& state) -> void {
+        static auto slot = AtomicArc(Arc<Config>(u64{1}, u64{2}));
+
+        auto version = u64{0};
+        for (auto _ : state) {
+            if (state.thread_index() == 0) {
+                slot.store(Arc<Config>(++version, u64{2}));
+            } else {
+                auto snapshot = slot.load();
+                benchmark::DoNotOptimize(snapshot->limit);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Baseline: a shared_ptr guarded by a mutex
+    auto mutex_shared_ptr_load(benchmark::State& state) -> void {
+        static auto mutex = std::mutex();
+        static auto shared = std::make_shared<Config>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            auto snapshot = [] {
+                auto lock = std::scoped_lock(mutex);
+                return shared;
+            }();
+            benchmark::DoNotOptimize(snapshot->limit);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Baseline: std::atomic<std::shared_ptr>, lock-based in libstdc++
+    auto atomic_shared_ptr_load(benchmark::State& state) -> void {
+        static auto shared = std::atomic<std::shared_ptr<Config>>(
+            std::make_shared<Config>(u64{1}, u64{2}));
+
+        for (auto _ : state) {
+            auto snapshot = shared.load();
+            benchmark::DoNotOptimize(snapshot->limit);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    auto atomic_shared_ptr_load_store(benchmark::State& state) -> void {
+        static auto shared = std::atomic<std::shared_ptr<Config>>(
+            std::make_shared<Config>(u64{1}, u64{2}));
+
+        auto version = u64{0};
+        for (auto _ : state) {
+            if (state.thread_index() == 0) {
+                shared.store(std::make_shared<Config>(++version, u64{2}));
+            } else {
+                auto snapshot = shared.load();
+                benchmark::DoNotOptimize(snapshot->limit);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+}; // namespace
+
+BENCHMARK(atomic_arc_load)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(atomic_arc_load_store)->ThreadRange(2, 32)->UseRealTime();
+BENCHMARK(mutex_shared_ptr_load)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(atomic_shared_ptr_load)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(atomic_shared_ptr_load_store)->ThreadRange(2, 32)->UseRealTime();
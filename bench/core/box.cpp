@@ -0,0 +1,87 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/box.hpp"
+#include "alloc_counter.hpp"
+
+#include <memory>
+
+using namespace lx::core;
+
+namespace {
+
+    struct Payload {
+            u64 a = 0;
+            u64 b = 0;
+    };
+
+    auto report_allocations(benchmark::State& state, usize before) -> void {
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(lx::bench::allocation_count() - before),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    auto box_construct_destroy(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto box = Box<Payload>(u64{1}, u64{2});
+            benchmark::DoNotOptimize(box.unsafe_get());
+        }
+
+        report_allocations(state, before);
+    }
+
+    auto unique_ptr_construct_destroy(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto ptr = std::make_unique<Payload>(u64{1}, u64{2});
+            benchmark::DoNotOptimize(ptr.get());
+        }
+
+        report_allocations(state, before);
+    }
+
+    // Ownership passed down and back up a call chain: Box and unique_ptr are
+    // both one pointer, but only a trivially relocatable type would be
+    // passed in a register
+    [[gnu::noinline]] auto box_pass(Box<Payload> box, i32 depth) noexcept
+        -> Box<Payload> {
+
+        if (depth == 0) return box;
+
+        return box_pass(std::move(box), depth - 1);
+    }
+
+    [[gnu::noinline]] auto unique_ptr_pass(std::unique_ptr<Payload> ptr,
+                                           i32 depth) noexcept
+        -> std::unique_ptr<Payload> {
+
+        if (depth == 0) return ptr;
+
+        return unique_ptr_pass(std::move(ptr), depth - 1);
+    }
+
+    auto box_move_chain(benchmark::State& state) -> void {
+        auto box = Box<Payload>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            box = box_pass(std::move(box), 4);
+            benchmark::DoNotOptimize(box.unsafe_get());
+        }
+    }
+
+    auto unique_ptr_move_chain(benchmark::State& state) -> void {
+        auto ptr = std::make_unique<Payload>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            ptr = unique_ptr_pass(std::move(ptr), 4);
+            benchmark::DoNotOptimize(ptr.get());
+        }
+    }
+
+}; // namespace
+
+BENCHMARK(box_construct_destroy);
+BENCHMARK(unique_ptr_construct_destroy);
+BENCHMARK(box_move_chain);
+BENCHMARK(unique_ptr_move_chain);
@@ -0,0 +1,66 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/atomic_arc.hpp"
+#include "lastix/core/epoch.hpp"
+
+#include <atomic>
+
+using namespace lx::core;
+
+namespace {
+
+    struct Config {
+            u64 version = 0;
+            u64 limit = 0;
+    };
+
+    // Readers only: pin, read through a plain atomic pointer, unpin
+    auto epoch_pinned_load(benchmark::State& state) -> void {
+        static auto slot = std::atomic<Config*>(new Config{1, 2});
+
+        for (auto _ : state) {
+            auto guard = Epoch::pin();
+            auto* snapshot = slot.load(std::memory_order_acquire);
+            benchmark::DoNotOptimize(snapshot->limit);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Thread 0 keeps publishing and retiring snapshots while others read
+    auto epoch_pinned_load_store(benchmark::State& state) -> void {
+        static auto slot = std::atomic<Config*>(new Config{1, 2});
+
+        auto version = u64{0};
+        for (auto _ : state) {
+            auto guard = Epoch::pin();
+
+            if (state.thread_index() == 0) {
+                auto* old = slot.exchange(new Config{++version, 2},
+                                          std::memory_order_acq_rel);
+                guard.retire(old);
+            } else {
+                auto* snapshot = slot.load(std::memory_order_acquire);
+                benchmark::DoNotOptimize(snapshot->limit);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Baseline: the same reads through AtomicArc
+    auto epoch_baseline_atomic_arc_load(benchmark::State& state) -> void {
+        static auto slot = AtomicArc(Arc<Config>(u64{1}, u64{2}));
+
+        for (auto _ : state) {
+            auto snapshot = slot.load();
+            benchmark::DoNotOptimize(snapshot->limit);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+}; // namespace
+
+BENCHMARK(epoch_pinned_load)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(epoch_pinned_load_store)->ThreadRange(2, 32)->UseRealTime();
+BENCHMARK(epoch_baseline_atomic_arc_load)->ThreadRange(1, 32)->UseRealTime();
@@ -0,0 +1,200 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/arena.hpp"
+#include "lastix/core/error.hpp"
+#include "lastix/core/result.hpp"
+#include "alloc_counter.hpp"
+
+#include <format>
+#include <string>
+
+using namespace lx::core;
+
+namespace {
+
+    auto report_allocations(benchmark::State& state, usize before) -> void {
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(lx::bench::allocation_count() - before),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    [[gnu::noinline]] auto fail_literal() noexcept -> Result<i32, Error> {
+        return Err("File not found");
+    }
+
+    [[gnu::noinline]] auto fail_string() noexcept -> Result<i32, Error> {
+        return Err(std::string("File not found"));
+    }
+
+    // Literal messages are borrowed: no allocation, no copy
+    auto error_create_literal(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto r = fail_literal();
+            benchmark::DoNotOptimize(r);
+        }
+
+        report_allocations(state, before);
+    }
+
+    // What every Err("...") cost before: a StringError box and a std::string
+    auto error_create_string(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto r = fail_string();
+            benchmark::DoNotOptimize(r);
+        }
+
+        report_allocations(state, before);
+    }
+
+    struct IoError {
+            i32 code;
+            usize offset;
+
+            auto what() const noexcept -> std::string_view {
+                return "I/O failure";
+            }
+    };
+
+    [[gnu::noinline]] auto fail_typed() noexcept -> Result<i32, Error> {
+        return Err(IoError{5, 4096});
+    }
+
+    // A typed payload lives in the Error's inline buffer: no allocation
+    auto error_create_typed(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto r = fail_typed();
+            benchmark::DoNotOptimize(r);
+        }
+
+        report_allocations(state, before);
+    }
+
+    // Getting the payload back is one pointer comparison
+    auto error_downcast(benchmark::State& state) -> void {
+        auto r = fail_typed();
+        const auto& e = r.unwrap_err();
+
+        for (auto _ : state) {
+            auto io = e.downcast<IoError>();
+            benchmark::DoNotOptimize(io);
+        }
+    }
+
+    constexpr auto context_layers = 6;
+
+    [[gnu::noinline]] auto fail_layered(i32 layers) noexcept
+        -> Result<i32, Error> {
+
+        if (layers == 0) return fail_string();
+
+        return fail_layered(layers - 1)
+            .context("while handling layer " + std::to_string(layers));
+    }
+
+    // Six runtime context messages on the heap: one copy each plus the frame
+    // array
+    auto error_context_heap(benchmark::State& state) -> void {
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            auto r = fail_layered(context_layers);
+            benchmark::DoNotOptimize(r);
+        }
+
+        report_allocations(state, before);
+    }
+
+    // The same chain with frames and copies bump-allocated in an arena that
+    // is reset once per request
+    auto error_context_arena(benchmark::State& state) -> void {
+        auto arena = ErrorArena();
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            {
+                auto scope = arena.enter();
+                auto r = fail_layered(context_layers);
+                benchmark::DoNotOptimize(r);
+            }
+            arena.reset();
+        }
+
+        report_allocations(state, before);
+    }
+
+    [[gnu::noinline]] auto succeed(i32 value) noexcept -> Result<i32, Error> {
+        return Ok(value);
+    }
+
+    // Context formatted up front, as callers did before context_fmt: the
+    // string is built and dropped even though the call succeeded
+    auto error_context_eager_ok(benchmark::State& state) -> void {
+        auto record = i32{0};
+
+        for (auto _ : state) {
+            auto r = succeed(record).context(
+                std::format("while parsing record {}", record));
+            benchmark::DoNotOptimize(r);
+            record++;
+        }
+    }
+
+    // The same call with context_fmt: Ok results only pay for the branch
+    auto error_context_lazy_ok(benchmark::State& state) -> void {
+        auto record = i32{0};
+
+        for (auto _ : state) {
+            auto r =
+                succeed(record).context_fmt("while parsing record {}", record);
+            benchmark::DoNotOptimize(r);
+            record++;
+        }
+    }
+
+    // On the error path context_fmt formats once and copies into the arena
+    auto error_context_fmt_arena(benchmark::State& state) -> void {
+        auto arena = ErrorArena();
+        auto before = lx::bench::allocation_count();
+
+        for (auto _ : state) {
+            {
+                auto scope = arena.enter();
+                auto r = fail_literal().context_fmt("while parsing record {}",
+                                                    context_layers);
+                benchmark::DoNotOptimize(r);
+            }
+            arena.reset();
+        }
+
+        report_allocations(state, before);
+    }
+
+    // Formatting the whole chain, the way a top-level handler reports it
+    auto error_write(benchmark::State& state) -> void {
+        auto r = fail_layered(context_layers);
+        const auto& e = r.unwrap_err();
+
+        for (auto _ : state) {
+            auto total = usize{0};
+            e.write([&](std::string_view what) { total += what.size(); });
+            benchmark::DoNotOptimize(total);
+        }
+    }
+
+}; // namespace
+
+BENCHMARK(error_create_literal);
+BENCHMARK(error_create_string);
+BENCHMARK(error_create_typed);
+BENCHMARK(error_downcast);
+BENCHMARK(error_context_heap);
+BENCHMARK(error_context_arena);
+BENCHMARK(error_context_eager_ok);
+BENCHMARK(error_context_lazy_ok);
+BENCHMARK(error_context_fmt_arena);
+BENCHMARK(error_write);
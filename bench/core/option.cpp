@@ -0,0 +1,156 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/box.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+
+#include <memory>
+#include <optional>
+
+using namespace lx::core;
+
+namespace {
+
+    // Each level is a real call, so the Option crosses four call boundaries
+    // and is checked at every one of them
+
+    [[gnu::noinline]] auto option_chain(i32 x, i32 depth) noexcept
+        -> Option<i32> {
+
+        if (depth == 0) {
+            if (x < 0) [[unlikely]]
+                return None;
+
+            return Some(x + 1);
+        }
+
+        auto o = option_chain(x, depth - 1);
+        if (o.is_none()) return None;
+
+        return Some(o.unwrap() + 1);
+    }
+
+    [[gnu::noinline]] auto optional_chain(i32 x, i32 depth) noexcept
+        -> std::optional<i32> {
+
+        if (depth == 0) {
+            if (x < 0) [[unlikely]]
+                return std::nullopt;
+
+            return x + 1;
+        }
+
+        auto o = optional_chain(x, depth - 1);
+        if (!o) return std::nullopt;
+
+        return *o + 1;
+    }
+
+    // Option<Box> stores None in the pointer, std::optional<unique_ptr> needs
+    // an extra flag and twice the size
+    [[gnu::noinline]] auto option_box_chain(Option<Box<i32>> o,
+                                            i32 depth) noexcept
+        -> Option<Box<i32>> {
+
+        if (depth == 0 || o.is_none()) return o;
+
+        return option_box_chain(std::move(o), depth - 1);
+    }
+
+    [[gnu::noinline]] auto optional_unique_chain(
+        std::optional<std::unique_ptr<i32>> o, i32 depth) noexcept
+        -> std::optional<std::unique_ptr<i32>> {
+
+        if (depth == 0 || !o) return o;
+
+        return optional_unique_chain(std::move(o), depth - 1);
+    }
+
+    // The same lookup pipeline written with combinators and by hand. Both
+    // are noinline so their code size can be compared directly:
+    //   nm -C -S --size-sort lastix-bench | grep _pipeline
+
+    [[gnu::noinline]] auto combinator_pipeline(const Option<Box<i32>>& slot)
+        noexcept -> i32 {
+        return slot.as_ref()
+            .map([](const Box<i32>& b) { return *b; })
+            .and_then([](i32 x) -> Option<i32> {
+                if (x < 0) return None;
+                return Some(x * 2);
+            })
+            .unwrap_or(0);
+    }
+
+    [[gnu::noinline]] auto branch_pipeline(const Option<Box<i32>>& slot)
+        noexcept -> i32 {
+        if (slot.is_none()) return 0;
+
+        auto x = *slot.unwrap();
+        if (x < 0) return 0;
+
+        return x * 2;
+    }
+
+    auto option_call_chain(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto o = option_chain(x, 4);
+            benchmark::DoNotOptimize(o);
+        }
+    }
+
+    auto optional_call_chain(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto o = optional_chain(x, 4);
+            benchmark::DoNotOptimize(o);
+        }
+    }
+
+    auto option_box_call_chain(benchmark::State& state) -> void {
+        auto o = Option<Box<i32>>(Some(Box<i32>(1)));
+
+        for (auto _ : state) {
+            o = option_box_chain(std::move(o), 4);
+            benchmark::DoNotOptimize(o);
+        }
+    }
+
+    auto optional_unique_call_chain(benchmark::State& state) -> void {
+        auto o = std::optional(std::make_unique<i32>(1));
+
+        for (auto _ : state) {
+            o = optional_unique_chain(std::move(o), 4);
+            benchmark::DoNotOptimize(o);
+        }
+    }
+
+    auto option_combinators(benchmark::State& state) -> void {
+        auto slot = Option<Box<i32>>(Some(Box<i32>(21)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(slot);
+            benchmark::DoNotOptimize(combinator_pipeline(slot));
+        }
+    }
+
+    auto option_branches(benchmark::State& state) -> void {
+        auto slot = Option<Box<i32>>(Some(Box<i32>(21)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(slot);
+            benchmark::DoNotOptimize(branch_pipeline(slot));
+        }
+    }
+
+}; // namespace
+
+BENCHMARK(option_call_chain);
+BENCHMARK(optional_call_chain);
+BENCHMARK(option_box_call_chain);
+BENCHMARK(optional_unique_call_chain);
+BENCHMARK(option_combinators);
+BENCHMARK(option_branches);
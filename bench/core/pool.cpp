@@ -0,0 +1,67 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/arc.hpp"
+#include "lastix/core/box.hpp"
+#include "lastix/core/pool.hpp"
+
+#include <vector>
+
+using namespace lx::core;
+
+namespace {
+
+    struct Connection {
+            u64 id = 0;
+            u64 bytes_in = 0;
+            u64 bytes_out = 0;
+            u64 state = 0;
+    };
+
+    // Live objects per thread: each iteration replaces all of them, the way
+    // connections and parsed headers come and go under load
+    constexpr auto churn_objects = 64;
+
+    template <class Make>
+    auto churn(benchmark::State& state, Make make) -> void {
+        using Handle = decltype(make(u64{0}));
+
+        auto live = std::vector<Handle>();
+        live.reserve(churn_objects);
+        for (auto i = u64{0}; i < churn_objects; i++) live.push_back(make(i));
+
+        for (auto _ : state) {
+            for (auto& handle : live) {
+                handle = make(u64{1});
+                benchmark::DoNotOptimize(handle);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * churn_objects);
+    }
+
+    // Global heap through DefaultDeleter
+    auto box_churn_default(benchmark::State& state) -> void {
+        churn(state, [](u64 id) { return Box<Connection>(id, u64{0}); });
+    }
+
+    auto box_churn_pool(benchmark::State& state) -> void {
+        churn(state, [](u64 id) {
+            return Pool<Connection>::make_box(id, u64{0});
+        });
+    }
+
+    auto arc_churn_default(benchmark::State& state) -> void {
+        churn(state, [](u64 id) { return Arc<Connection>(id, u64{0}); });
+    }
+
+    auto arc_churn_pool(benchmark::State& state) -> void {
+        churn(state, [](u64 id) {
+            return Pool<Connection>::make_arc(id, u64{0});
+        });
+    }
+
+}; // namespace
+
+BENCHMARK(box_churn_default)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(box_churn_pool)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(arc_churn_default)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(arc_churn_pool)->ThreadRange(1, 16)->UseRealTime();
@@ -0,0 +1,192 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/error.hpp"
+#include "lastix/core/result.hpp"
+#include "lastix/core/try.hpp"
+
+#include <expected>
+
+using namespace lx::core;
+
+namespace {
+
+    // Each level is a real call, so the Result crosses four call boundaries.
+    // Error has a destructor, so Result<i32, Error> and std::expected are both
+    // returned through memory and only their size and tag checks differ
+
+    [[gnu::noinline]] auto result_leaf(i32 x) noexcept -> Result<i32, Error> {
+        if (x < 0) [[unlikely]]
+            return Err(Error("negative input"));
+
+        return Ok(x + 1);
+    }
+
+    [[gnu::noinline]] auto result_chain(i32 x, i32 depth) noexcept
+        -> Result<i32, Error> {
+
+        if (depth == 0) return result_leaf(x);
+
+        auto r = result_chain(x, depth - 1);
+        if (r.is_err()) return r;
+
+        return Ok(r.unwrap() + 1);
+    }
+
+    // The same chain propagating through LX_TRY
+    [[gnu::noinline]] auto try_chain(i32 x, i32 depth) noexcept
+        -> Result<i32, Error> {
+
+        if (depth == 0) return result_leaf(x);
+
+        auto value = LX_TRY(try_chain(x, depth - 1));
+        return Ok(value + 1);
+    }
+
+    [[gnu::noinline]] auto expected_leaf(i32 x) noexcept
+        -> std::expected<i32, Error> {
+        if (x < 0) [[unlikely]]
+            return std::unexpected(Error("negative input"));
+
+        return x + 1;
+    }
+
+    [[gnu::noinline]] auto expected_chain(i32 x, i32 depth) noexcept
+        -> std::expected<i32, Error> {
+
+        if (depth == 0) return expected_leaf(x);
+
+        auto r = expected_chain(x, depth - 1);
+        if (!r) return r;
+
+        return *r + 1;
+    }
+
+    [[gnu::noinline]] auto plain_chain(i32 x, i32 depth) noexcept -> i32 {
+        if (depth == 0) return x + 1;
+
+        return plain_chain(x, depth - 1) + 1;
+    }
+
+    // One step of the chain written with combinators; the code size of the
+    // two _step functions shows what the lambdas cost once inlined:
+    //   nm -C -S --size-sort lastix-bench | grep _step
+
+    [[gnu::noinline]] auto combinator_step(Result<i32, Error> r) noexcept
+        -> Result<i32, Error> {
+        return std::move(r)
+            .and_then([](i32 x) { return result_leaf(x); })
+            .map([](i32 x) { return x + 1; });
+    }
+
+    [[gnu::noinline]] auto branch_step(Result<i32, Error> r) noexcept
+        -> Result<i32, Error> {
+        if (r.is_err()) return r;
+
+        auto next = result_leaf(r.unwrap());
+        if (next.is_err()) return next;
+
+        return Ok(next.unwrap() + 1);
+    }
+
+    auto result_call_chain(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = result_chain(x, 4);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    auto expected_call_chain(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = expected_chain(x, 4);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    auto try_call_chain(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = try_chain(x, 4);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    auto try_call_chain_err(benchmark::State& state) -> void {
+        auto x = i32{-1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = try_chain(x, 4);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    // Lower bound: the same chain without an error channel
+    auto plain_call_chain(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = plain_chain(x, 4);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    // The error path is dominated by building the Error
+    auto result_call_chain_err(benchmark::State& state) -> void {
+        auto x = i32{-1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = result_chain(x, 4);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    auto expected_call_chain_err(benchmark::State& state) -> void {
+        auto x = i32{-1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = expected_chain(x, 4);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    auto result_combinators(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = combinator_step(Ok(x));
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+    auto result_branches(benchmark::State& state) -> void {
+        auto x = i32{1};
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(x);
+            auto r = branch_step(Ok(x));
+            benchmark::DoNotOptimize(r);
+        }
+    }
+
+}; // namespace
+
+BENCHMARK(result_call_chain);
+BENCHMARK(expected_call_chain);
+BENCHMARK(try_call_chain);
+BENCHMARK(plain_call_chain);
+BENCHMARK(result_call_chain_err);
+BENCHMARK(expected_call_chain_err);
+BENCHMARK(try_call_chain_err);
+BENCHMARK(result_combinators);
+BENCHMARK(result_branches);
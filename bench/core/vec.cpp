@@ -0,0 +1,88 @@
+#include "benchmark/benchmark.h"
+#include "lastix/core/arc.hpp"
+#include "lastix/core/vec.hpp"
+
+#include <vector>
+
+using namespace lx::core;
+
+namespace {
+
+    // Growing from empty: the two grow alike, Vec through realloc()
+    auto vec_push_u64(benchmark::State& state) -> void {
+        auto count = static_cast<u64>(state.range(0));
+
+        for (auto _ : state) {
+            auto vec = Vec<u64>();
+            for (auto i = u64{0}; i < count; i++) vec.push(i);
+            benchmark::DoNotOptimize(vec.unsafe_get());
+        }
+    }
+
+    auto std_vector_push_u64(benchmark::State& state) -> void {
+        auto count = static_cast<u64>(state.range(0));
+
+        for (auto _ : state) {
+            auto vec = std::vector<u64>();
+            for (auto i = u64{0}; i < count; i++) vec.push_back(i);
+            benchmark::DoNotOptimize(vec.data());
+        }
+    }
+
+    // Every element moves to a new block and back. Arcs are relocated with
+    // memcpy/realloc; std::vector moves each one and destroys the original,
+    // which reads and writes every handle twice
+    auto vec_relocate_arc(benchmark::State& state) -> void {
+        auto shared = Arc<u64>(u64{1});
+        auto vec = Vec<Arc<u64>>::with_capacity(
+            static_cast<usize>(state.range(0)));
+        while (vec.len() < vec.capacity()) vec.push(shared);
+
+        for (auto _ : state) {
+            vec.reserve(1);
+            vec.shrink_to_fit();
+            benchmark::DoNotOptimize(vec.unsafe_get());
+        }
+    }
+
+    auto std_vector_relocate_arc(benchmark::State& state) -> void {
+        auto shared = Arc<u64>(u64{1});
+        auto vec = std::vector<Arc<u64>>(static_cast<usize>(state.range(0)),
+                                         shared);
+        vec.shrink_to_fit();
+
+        for (auto _ : state) {
+            vec.reserve(vec.size() + 1);
+            vec.shrink_to_fit();
+            benchmark::DoNotOptimize(vec.data());
+        }
+    }
+
+    // Removing every other element: one memmove per kept run
+    auto vec_retain_arc(benchmark::State& state) -> void {
+        auto shared = Arc<u64>(u64{1});
+        auto count = static_cast<usize>(state.range(0));
+        auto vec = Vec<Arc<u64>>::with_capacity(count);
+
+        for (auto _ : state) {
+            state.PauseTiming();
+            vec.clear();
+            for (auto i = usize{0}; i < count; i++) vec.push(shared);
+            state.ResumeTiming();
+
+            auto keep = false;
+            vec.retain([&](const Arc<u64>&) { return keep = !keep; });
+            benchmark::DoNotOptimize(vec.unsafe_get());
+        }
+    }
+
+}; // namespace
+
+BENCHMARK(vec_push_u64)->Arg(1000);
+BENCHMARK(std_vector_push_u64)->Arg(1000);
+BENCHMARK(vec_relocate_arc)->Arg(1 << 10)->Arg(1 << 16)->Arg(10'000'000);
+BENCHMARK(std_vector_relocate_arc)
+    ->Arg(1 << 10)
+    ->Arg(1 << 16)
+    ->Arg(10'000'000);
+BENCHMARK(vec_retain_arc)->Arg(1 << 16);
@@ -0,0 +1,161 @@
+#include "benchmark/benchmark.h"
+#include "lastix/sync/channel.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace lx::core;
+using namespace lx::sync;
+
+namespace {
+
+    constexpr auto items_per_run = u64{1} << 16;
+    constexpr auto queue_capacity = usize{1024};
+
+    /// Baseline: the mutex + condvar queue the pipeline uses today.
+    class LockedQueue {
+
+        public:
+            auto push(u64 value) -> void {
+                auto lock = std::unique_lock(_mutex);
+                _not_full.wait(lock, [&] { return _items.size() < _limit; });
+                _items.push_back(value);
+                lock.unlock();
+                _not_empty.notify_one();
+            }
+
+            auto pop() -> u64 {
+                auto lock = std::unique_lock(_mutex);
+                _not_empty.wait(lock, [&] { return !_items.empty(); });
+                auto value = _items.front();
+                _items.pop_front();
+                lock.unlock();
+                _not_full.notify_one();
+                return value;
+            }
+
+        private:
+            std::mutex _mutex;
+            std::condition_variable _not_empty;
+            std::condition_variable _not_full;
+            std::deque<u64> _items;
+            usize _limit = queue_capacity;
+    };
+
+    // N producers share items_per_run values; the bench thread receives
+    auto channel_throughput(benchmark::State& state) -> void {
+        auto producers = static_cast<u64>(state.range(0));
+
+        for (auto _ : state) {
+            auto [tx, rx] = channel<u64>(queue_capacity);
+            auto threads = std::vector<std::jthread>();
+
+            for (auto p = u64{0}; p < producers; p++) {
+                threads.emplace_back([sender = tx, producers] mutable {
+                    for (auto i = u64{0}; i < items_per_run / producers; i++)
+                        if (sender.send(i).is_err()) return;
+                });
+            }
+            {
+                auto dropped = std::move(tx);
+            }
+
+            auto sum = u64{0};
+            while (auto value = rx.recv()) sum += value.unwrap();
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<i64>(items_per_run));
+    }
+
+    auto locked_queue_throughput(benchmark::State& state) -> void {
+        auto producers = static_cast<u64>(state.range(0));
+        auto per_producer = items_per_run / producers;
+
+        for (auto _ : state) {
+            auto queue = LockedQueue();
+            auto threads = std::vector<std::jthread>();
+
+            for (auto p = u64{0}; p < producers; p++) {
+                threads.emplace_back([&queue, per_producer] {
+                    for (auto i = u64{0}; i < per_producer; i++)
+                        queue.push(i);
+                });
+            }
+
+            auto sum = u64{0};
+            for (auto i = u64{0}; i < per_producer * producers; i++)
+                sum += queue.pop();
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<i64>(items_per_run));
+    }
+
+    // One producer, one consumer: the wait-free ring against the MPMC one
+    auto spsc_channel_throughput(benchmark::State& state) -> void {
+        for (auto _ : state) {
+            auto [tx, rx] = spsc_channel<u64>(queue_capacity);
+
+            auto producer = std::jthread([sender = std::move(tx)] mutable {
+                for (auto i = u64{0}; i < items_per_run; i++)
+                    if (sender.send(i).is_err()) return;
+            });
+
+            auto sum = u64{0};
+            while (auto value = rx.recv()) sum += value.unwrap();
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(state.iterations() *
+                                static_cast<i64>(items_per_run));
+    }
+
+    // Round trip through two channels: one message each way per iteration
+    template <class Make>
+    auto ping_pong(benchmark::State& state, Make make) -> void {
+        auto [ping_tx, ping_rx] = make();
+        auto [pong_tx, pong_rx] = make();
+
+        auto echo = std::jthread(
+            [receiver = std::move(ping_rx), sender = std::move(pong_tx)]
+            mutable {
+                while (auto value = receiver.recv())
+                    if (sender.send(value.unwrap()).is_err()) return;
+            });
+
+        auto i = u64{0};
+        for (auto _ : state) {
+            if (ping_tx.send(i++).is_err()) break;
+            benchmark::DoNotOptimize(pong_rx.recv());
+        }
+
+        // Disconnects the echo thread
+        auto dropped = std::move(ping_tx);
+    }
+
+    auto channel_latency(benchmark::State& state) -> void {
+        ping_pong(state, [] { return channel<u64>(queue_capacity); });
+    }
+
+    auto spsc_channel_latency(benchmark::State& state) -> void {
+        ping_pong(state, [] { return spsc_channel<u64>(queue_capacity); });
+    }
+
+}; // namespace
+
+BENCHMARK(channel_throughput)->Arg(1)->Arg(2)->Arg(8)->Arg(32)->UseRealTime();
+BENCHMARK(locked_queue_throughput)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(8)
+    ->Arg(32)
+    ->UseRealTime();
+BENCHMARK(spsc_channel_throughput)->UseRealTime();
+BENCHMARK(channel_latency)->UseRealTime();
+BENCHMARK(spsc_channel_latency)->UseRealTime();
@@ -0,0 +1,106 @@
+#include "benchmark/benchmark.h"
+#include "lastix/sync/mutex.hpp"
+#include "lastix/sync/rwlock.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+
+using namespace lx::core;
+using namespace lx::sync;
+
+namespace {
+
+    struct Config {
+            u64 version = 0;
+            u64 limit = 0;
+    };
+
+    // Readers only: every thread read-locks and reads a field
+    auto rwlock_read(benchmark::State& state) -> void {
+        static auto lock = RwLock<Config>(u64{1}, u64{2});
+
+        for (auto _ : state) {
+            auto guard = lock.read();
+            benchmark::DoNotOptimize(guard->limit);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Baseline: all readers bump the same word inside std::shared_mutex
+    auto shared_mutex_read(benchmark::State& state) -> void {
+        static auto mutex = std::shared_mutex();
+        static auto config = Config{1, 2};
+
+        for (auto _ : state) {
+            auto lock = std::shared_lock(mutex);
+            benchmark::DoNotOptimize(config.limit);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Read-mostly: thread 0 writes every 1024th iteration
+    auto rwlock_read_mostly(benchmark::State& state) -> void {
+        static auto lock = RwLock<Config>(u64{1}, u64{2});
+
+        auto i = u64{0};
+        for (auto _ : state) {
+            if (state.thread_index() == 0 && ++i % 1024 == 0) {
+                lock.write()->version++;
+            } else {
+                auto guard = lock.read();
+                benchmark::DoNotOptimize(guard->limit);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    auto shared_mutex_read_mostly(benchmark::State& state) -> void {
+        static auto mutex = std::shared_mutex();
+        static auto config = Config{1, 2};
+
+        auto i = u64{0};
+        for (auto _ : state) {
+            if (state.thread_index() == 0 && ++i % 1024 == 0) {
+                auto lock = std::unique_lock(mutex);
+                config.version++;
+            } else {
+                auto lock = std::shared_lock(mutex);
+                benchmark::DoNotOptimize(config.limit);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // Short critical sections under contention
+    auto mutex_increment(benchmark::State& state) -> void {
+        static auto counter = Mutex<u64>(u64{0});
+
+        for (auto _ : state) benchmark::DoNotOptimize(++*counter.lock());
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    auto std_mutex_increment(benchmark::State& state) -> void {
+        static auto mutex = std::mutex();
+        static auto counter = u64{0};
+
+        for (auto _ : state) {
+            auto lock = std::scoped_lock(mutex);
+            benchmark::DoNotOptimize(++counter);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+}; // namespace
+
+BENCHMARK(rwlock_read)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(shared_mutex_read)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(rwlock_read_mostly)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(shared_mutex_read_mostly)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(mutex_increment)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(std_mutex_increment)->ThreadRange(1, 32)->UseRealTime();
@@ -4,31 +4,399 @@
 #include "lastix/core/option.hpp"
 #include "lastix/core/number.hpp"
 #include "lastix/core/memory.hpp"
+#include "lastix/core/result.hpp"
+#include "lastix/trait/niche.hpp"
+#include "lastix/trait/relocatable.hpp"
+#include "lastix/trait/send.hpp"
 #include "lastix/trait/sync.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace lx::core {
 
     namespace impl {
 
+        /**
+         * @brief Reference counts shared by all Arc and Weak handles to one
+         * value.
+         *
+         * The block also owns the value's destruction, so an Arc<Base> made
+         * from an Arc<Derived> still destroys the Derived object through the
+         * deleter (or layout) it was created with.
+         *
+         * All strong handles together hold one implicit weak reference. The
+         * value is destroyed when strong_count reaches zero, the block itself
+         * when weak_count does, so a Weak can always read the counts of a
+         * dropped value.
+         *
+         * Increments are relaxed: a new reference can only be made from an
+         * existing one, which already orders it. Decrements release, and only
+         * the thread that drops the last reference issues an acquire fence,
+         * so every write made through other handles happens before the value
+         * (or the block) is destroyed.
+         */
         struct ArcControlBlock {
 
+                /// Counts past this point panic instead of wrapping around.
+                static constexpr auto max_count =
+                    std::numeric_limits<usize>::max() / 2;
+
+                /// weak_count while is_unique() holds it.
+                static constexpr auto weak_locked =
+                    std::numeric_limits<usize>::max();
+
+                ArcControlBlock(usize strong, usize weak) noexcept
+                    : strong_count(strong), weak_count(weak) {
+                }
+
+                virtual ~ArcControlBlock() noexcept = default;
+
+                /// Destroys the managed value. Called once, on the last drop.
+                virtual auto drop_value() noexcept -> void = 0;
+
+                /// Address of the managed object, as it was allocated.
+                virtual auto object() noexcept -> void* = 0;
+
+                /// Frees the block itself, once the last Weak is gone.
+                virtual auto free_block() noexcept -> void {
+                    delete this;
+                }
+
+                /**
+                 * @brief A new block holding a copy of the whole object,
+                 * allocated and released the same way as this one, or
+                 * nullptr if the object cannot be copied.
+                 */
+                virtual auto clone() noexcept -> ArcControlBlock* {
+                    return nullptr;
+                }
+
+                auto retain(usize n = 1) noexcept -> void {
+                    if (strong_count.fetch_add(n, std::memory_order_relaxed) >
+                        max_count) [[unlikely]]
+                        panic("Arc reference count overflow");
+                }
+
+                auto release(usize n = 1) noexcept -> void {
+                    if (strong_count.fetch_sub(n, std::memory_order_release) !=
+                        n)
+                        return;
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    this->drop_value();
+                    this->release_weak();
+                }
+
+                /**
+                 * @brief Takes a strong reference unless the value has
+                 * already been dropped. A zero count is never resurrected.
+                 */
+                [[nodiscard]] auto try_retain() noexcept -> bool {
+                    auto count = strong_count.load(std::memory_order_relaxed);
+
+                    while (count != 0) {
+                        if (count > max_count) [[unlikely]]
+                            panic("Arc reference count overflow");
+
+                        if (strong_count.compare_exchange_weak(
+                                count, count + 1, std::memory_order_acquire,
+                                std::memory_order_relaxed))
+                            return true;
+                    }
+
+                    return false;
+                }
+
+                /**
+                 * @brief True if the caller's handle is the only Arc and no
+                 * Weak exists.
+                 *
+                 * The weak count is locked while the strong count is read:
+                 * otherwise another handle could downgrade and drop itself
+                 * in between, leaving a Weak to a value we think we own.
+                 */
+                [[nodiscard]] auto is_unique() noexcept -> bool {
+                    auto weak = usize{1};
+                    if (!weak_count.compare_exchange_strong(
+                            weak, weak_locked, std::memory_order_acquire,
+                            std::memory_order_relaxed))
+                        return false;
+
+                    auto unique =
+                        strong_count.load(std::memory_order_acquire) == 1;
+                    weak_count.store(1, std::memory_order_release);
+
+                    return unique;
+                }
+
+                /**
+                 * @brief Takes a weak reference for a Weak made from a strong
+                 * handle, waiting out a concurrent is_unique().
+                 */
+                auto downgrade() noexcept -> void {
+                    auto count = weak_count.load(std::memory_order_relaxed);
+
+                    while (true) {
+                        if (count == weak_locked) [[unlikely]] {
+                            count = weak_count.load(std::memory_order_relaxed);
+                            continue;
+                        }
+
+                        if (count > max_count) [[unlikely]]
+                            panic("Arc weak reference count overflow");
+
+                        if (weak_count.compare_exchange_weak(
+                                count, count + 1, std::memory_order_acquire,
+                                std::memory_order_relaxed))
+                            return;
+                    }
+                }
+
+                /// Weak copies only: a Weak rules out a locked count.
+                auto retain_weak() noexcept -> void {
+                    if (weak_count.fetch_add(1, std::memory_order_relaxed) >
+                        max_count) [[unlikely]]
+                        panic("Arc weak reference count overflow");
+                }
+
+                auto release_weak() noexcept -> void {
+                    if (weak_count.fetch_sub(1, std::memory_order_release) != 1)
+                        return;
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    this->free_block();
+                }
+
                 std::atomic<usize> strong_count = 0;
                 std::atomic<usize> weak_count = 0;
         };
 
+        /**
+         * @brief Split layout: the value lives in its own allocation and is
+         * released through Deleter. Used by unsafe_from_raw() and by Arcs with
+         * a custom deleter. A stateful deleter is kept here, not in the Arc.
+         */
+        template <class T, class Deleter>
+        struct ArcPointerBlock final : ArcControlBlock {
+
+                explicit ArcPointerBlock(T* data, Deleter del = {}) noexcept
+                    : ArcControlBlock(1, 1), ptr(data),
+                      deleter(std::move(del)) {
+                }
+
+                auto drop_value() noexcept -> void override {
+                    deleter(std::exchange(ptr, nullptr));
+                }
+
+                auto object() noexcept -> void* override {
+                    return const_cast<void*>(static_cast<const void*>(ptr));
+                }
+
+                /// A copy from `new`, freed by a copy of the deleter.
+                auto clone() noexcept -> ArcControlBlock* override {
+
+                    if constexpr (std::copy_constructible<T> &&
+                                  std::copy_constructible<Deleter>) {
+                        return new ArcPointerBlock(new T(std::as_const(*ptr)),
+                                                   deleter);
+                    } else {
+                        return nullptr;
+                    }
+                }
+
+                T* ptr = nullptr;
+                [[no_unique_address]] Deleter deleter;
+        };
+
+        /**
+         * @brief Fused layout: the counts and the value share one allocation,
+         * so constructing an Arc costs a single `new` and the first access to
+         * the value touches the cache line the counts were just written to.
+         */
+        template <class T> struct ArcInplaceBlock final : ArcControlBlock {
+
+                template <class... Args>
+                explicit ArcInplaceBlock(Args&&... args) noexcept
+                    : ArcControlBlock(1, 1),
+                      value(std::forward<Args>(args)...) {
+                }
+
+                // The value is destroyed by drop_value(), never here
+                ~ArcInplaceBlock() noexcept override {
+                }
+
+                auto drop_value() noexcept -> void override {
+                    std::destroy_at(&value);
+                }
+
+                auto object() noexcept -> void* override {
+                    return const_cast<void*>(static_cast<const void*>(&value));
+                }
+
+                auto clone() noexcept -> ArcControlBlock* override {
+
+                    if constexpr (std::copy_constructible<T>)
+                        return new ArcInplaceBlock(std::as_const(value));
+                    else
+                        return nullptr;
+                }
+
+                union {
+                        T value;
+                };
+        };
+
+        /**
+         * @brief Fused layout in memory from an allocator. The block keeps
+         * the allocator and frees itself through it, so neither the counts
+         * nor the value touch the global heap.
+         */
+        template <class T, class Alloc>
+        struct ArcAllocBlock final : ArcControlBlock {
+
+                using Allocator = typename std::allocator_traits<
+                    Alloc>::template rebind_alloc<ArcAllocBlock>;
+
+                template <class... Args>
+                explicit ArcAllocBlock(const Alloc& a, Args&&... args) noexcept
+                    : ArcControlBlock(1, 1), alloc(a),
+                      value(std::forward<Args>(args)...) {
+                }
+
+                ~ArcAllocBlock() noexcept override {
+                }
+
+                auto drop_value() noexcept -> void override {
+                    std::destroy_at(&value);
+                }
+
+                auto object() noexcept -> void* override {
+                    return const_cast<void*>(static_cast<const void*>(&value));
+                }
+
+                auto free_block() noexcept -> void override {
+                    auto owner = std::move(alloc);
+                    std::destroy_at(this);
+                    std::allocator_traits<Allocator>::deallocate(owner, this,
+                                                                 1);
+                }
+
+                auto clone() noexcept -> ArcControlBlock* override {
+
+                    if constexpr (std::copy_constructible<T>) {
+                        auto owner = alloc;
+                        auto* cb = std::allocator_traits<Allocator>::allocate(
+                            owner, 1);
+
+                        return std::construct_at(cb, Alloc(owner),
+                                                 std::as_const(value));
+                    } else {
+                        return nullptr;
+                    }
+                }
+
+                [[no_unique_address]] Allocator alloc;
+
+                union {
+                        T value;
+                };
+        };
+
+        /**
+         * @brief Slice layout: the length and the elements follow the counts
+         * in one allocation.
+         */
+        template <class T> struct ArcSliceBlock final : ArcControlBlock {
+
+                static constexpr auto align =
+                    std::max(alignof(ArcControlBlock), alignof(T));
+
+                /// Elements start at the first T-aligned byte after the block.
+                static constexpr auto data_offset() noexcept -> usize {
+                    return (sizeof(ArcSliceBlock) + alignof(T) - 1) /
+                           alignof(T) * alignof(T);
+                }
+
+                explicit ArcSliceBlock(usize n) noexcept
+                    : ArcControlBlock(1, 1), len(n) {
+                }
+
+                /// A block with room for n elements, none of them built yet.
+                [[nodiscard]] static auto allocate(usize n) noexcept
+                    -> ArcSliceBlock* {
+
+                    constexpr auto offset = data_offset();
+
+                    if (n > (std::numeric_limits<usize>::max() - offset) /
+                                sizeof(T)) [[unlikely]]
+                        panic("Arc slice length overflows");
+
+                    auto* memory = ::operator new(offset + n * sizeof(T),
+                                                  std::align_val_t(align));
+
+                    return std::construct_at(
+                        static_cast<ArcSliceBlock*>(memory), n);
+                }
+
+                [[nodiscard]] auto data() noexcept -> T* {
+                    return reinterpret_cast<T*>(
+                        reinterpret_cast<std::byte*>(this) + data_offset());
+                }
+
+                auto drop_value() noexcept -> void override {
+                    std::destroy_n(this->data(), len);
+                }
+
+                auto object() noexcept -> void* override {
+                    return this->data();
+                }
+
+                auto free_block() noexcept -> void override {
+                    std::destroy_at(this);
+                    ::operator delete(static_cast<void*>(this),
+                                      std::align_val_t(align));
+                }
+
+                usize len;
+        };
+
+        template <class T, class Deleter, bool Packed> class AtomicArcSlot;
+
     }; // namespace impl
 
+    template <class T, class Deleter> class Weak;
+
     template <class T, class Deleter = DefaultDeleter<T>> class Arc {
 
         public:
+            /**
+             * @brief Constructs T in place.
+             *
+             * With the default deleter the value is placed inside the control
+             * block (one allocation). A custom deleter expects a pointer it
+             * can free on its own, so that case keeps the split layout.
+             */
             template <class... Args>
             requires std::constructible_from<T, Args...>
-            explicit Arc(Args&&... args) noexcept
-                : _data(new T(std::forward<Args>(args)...)),
-                  _cb(new impl::ArcControlBlock(1, 0)) {
+            explicit Arc(Args&&... args) noexcept {
+
+                if constexpr (std::same_as<Deleter, DefaultDeleter<T>>) {
+                    auto* cb = new impl::ArcInplaceBlock<T>(
+                        std::forward<Args>(args)...);
+                    _data = &cb->value;
+                    _cb = cb;
+                } else {
+                    _data = new T(std::forward<Args>(args)...);
+                    _cb = new impl::ArcPointerBlock<T, Deleter>(_data);
+                }
             }
 
             Arc(Arc&& other) noexcept
@@ -42,7 +410,7 @@ namespace lx::core {
                 if (_cb == nullptr) [[unlikely]]
                     return;
 
-                _cb->strong_count.fetch_add(1, std::memory_order_acq_rel);
+                _cb->retain();
             }
 
             auto operator=(Arc&& other) noexcept -> Arc& {
@@ -60,8 +428,7 @@ namespace lx::core {
                     this->reset();
 
                     if (other._cb != nullptr) {
-                        other._cb->strong_count.fetch_add(
-                            1, std::memory_order_acq_rel);
+                        other._cb->retain();
                         _data = other._data;
                         _cb = other._cb;
                     }
@@ -84,7 +451,7 @@ namespace lx::core {
                 if (_cb == nullptr) [[unlikely]]
                     return;
 
-                _cb->strong_count.fetch_add(1, std::memory_order_acq_rel);
+                _cb->retain();
             }
 
             template <class U>
@@ -102,8 +469,7 @@ namespace lx::core {
                 this->reset();
                 if (other._cb) [[likely]] {
 
-                    other._cb->strong_count.fetch_add(
-                        1, std::memory_order_acq_rel);
+                    other._cb->retain();
 
                     _data = static_cast<T*>(other._data);
                     _cb = other._cb;
@@ -115,10 +481,34 @@ namespace lx::core {
                 this->reset();
             }
 
-            [[nodiscard]] static auto unsafe_from_raw(T* data) noexcept
+            [[nodiscard]] static auto unsafe_from_raw(T* data,
+                                                      Deleter deleter = {})
+                noexcept -> Arc<T, Deleter> {
+
+                return Arc(data, new impl::ArcPointerBlock<T, Deleter>(
+                                     data, std::move(deleter)));
+            }
+
+            /**
+             * @brief Constructs T inside a control block allocated from
+             * alloc. The allocator is type-erased by the block, so the result
+             * is a plain Arc<T>.
+             */
+            template <class Alloc, class... Args>
+            requires std::constructible_from<T, Args...>
+            [[nodiscard]] static auto new_in(const Alloc& alloc,
+                                             Args&&... args) noexcept
                 -> Arc<T, Deleter> {
 
-                return Arc(data, new impl::ArcControlBlock(1, 0));
+                using Block = impl::ArcAllocBlock<T, Alloc>;
+                using Allocator = typename Block::Allocator;
+
+                auto block_alloc = Allocator(alloc);
+                auto* cb =
+                    std::allocator_traits<Allocator>::allocate(block_alloc, 1);
+                std::construct_at(cb, alloc, std::forward<Args>(args)...);
+
+                return Arc(&cb->value, cb);
             }
 
             auto reset() noexcept -> void {
@@ -126,13 +516,20 @@ namespace lx::core {
                 if (_cb == nullptr) [[unlikely]]
                     return;
 
-                if (_cb->strong_count.fetch_sub(1, std::memory_order_acq_rel) ==
-                    1) {
-                    Deleter{}(std::exchange(_data, nullptr));
-                    if (_cb->weak_count.load(std::memory_order_acquire) == 0) {
-                        delete std::exchange(_cb, nullptr);
-                    }
-                }
+                _data = nullptr;
+                std::exchange(_cb, nullptr)->release();
+            }
+
+            /**
+             * @brief Creates a Weak handle to the same value. A Weak keeps the
+             * control block, but not the value, alive.
+             */
+            [[nodiscard]] auto downgrade() const noexcept -> Weak<T, Deleter> {
+                if (_cb == nullptr) [[unlikely]]
+                    return Weak<T, Deleter>();
+
+                _cb->downgrade();
+                return Weak<T, Deleter>(_data, _cb);
             }
 
             [[nodiscard]] auto operator->() const noexcept -> const T* {
@@ -195,7 +592,96 @@ namespace lx::core {
                 if (_cb == nullptr) [[unlikely]]
                     return None;
 
-                return Some(_cb->weak_count.load(std::memory_order_acquire));
+                auto weak = _cb->weak_count.load(std::memory_order_acquire);
+
+                // Locked by is_unique(), which only succeeds with no Weak
+                if (weak == impl::ArcControlBlock::weak_locked)
+                    return Some(usize{0});
+
+                // Discount the weak reference held by the strong handles
+                return Some(weak - 1);
+            }
+
+            /**
+             * @brief The value, if this is the only Arc and no Weak exists.
+             * Works for any T, unlike the Sync-gated operator*.
+             */
+            [[nodiscard]] auto get_mut() noexcept -> Option<T&> {
+
+                if (_cb == nullptr || !_cb->is_unique()) return None;
+
+                return Some<T&>(*_data);
+            }
+
+            /**
+             * @brief Mutable access, copying the value first unless this is
+             * its only owner. Other Arcs keep the old value; with Weaks
+             * around the value is copied too, and they stop upgrading once
+             * the old value's last Arc is gone.
+             *
+             * The copy is of the whole object, so an Arc<Base> made from an
+             * Arc<Derived> still points at a Derived. It is allocated and
+             * released like the original: through the same allocator for
+             * new_in(), with a copy of the deleter for a custom one. A value
+             * adopted by unsafe_from_raw() is copied as a T. Panics if the
+             * object itself cannot be copied.
+             */
+            [[nodiscard]] auto make_mut() noexcept -> T&
+            requires std::copy_constructible<T>
+            {
+                if (_data == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                if (_cb->is_unique()) return *_data;
+
+                auto* copy = _cb->clone();
+                if (copy == nullptr) [[unlikely]]
+                    panic("Arc::make_mut() cannot copy the shared object");
+
+                // Same offset into the copy, for an Arc to a base
+                auto offset = reinterpret_cast<const std::byte*>(_data) -
+                              static_cast<const std::byte*>(_cb->object());
+                auto* object = static_cast<std::byte*>(copy->object());
+
+                *this = Arc(std::launder(reinterpret_cast<T*>(object + offset)),
+                            copy);
+
+                return *_data;
+            }
+
+            /**
+             * @brief Moves the value out if this is the only Arc, otherwise
+             * gives the Arc back, as it does an empty one. Weaks stop
+             * upgrading either way once it succeeds.
+             */
+            [[nodiscard]] auto try_unwrap() && noexcept -> Result<T, Arc>
+            requires std::move_constructible<T>
+            {
+                if (_cb == nullptr) [[unlikely]]
+                    return Err(std::move(*this));
+
+                auto strong = usize{1};
+                if (!_cb->strong_count.compare_exchange_strong(
+                        strong, 0, std::memory_order_acquire,
+                        std::memory_order_relaxed))
+                    return Err(std::move(*this));
+
+                auto value = T(std::move(*_data));
+
+                // The moved-from value is still destroyed (and freed) by the
+                // block as if the last Arc had dropped it
+                auto* cb = std::exchange(_cb, nullptr);
+                _data = nullptr;
+                cb->drop_value();
+                cb->release_weak();
+
+                return Ok(std::move(value));
+            }
+
+            /// True if both handles point at the same value.
+            [[nodiscard]] static auto ptr_eq(const Arc& a,
+                                             const Arc& b) noexcept -> bool {
+                return a._data == b._data;
             }
 
         private:
@@ -204,10 +690,335 @@ namespace lx::core {
             }
 
             template <class U, class Del> friend class Arc;
+            template <class U, class Del> friend class Weak;
+            template <class U, class Del, bool Packed>
+            friend class impl::AtomicArcSlot;
 
         private:
             T* _data = nullptr;
             impl::ArcControlBlock* _cb = nullptr;
     };
 
+    /**
+     * @brief Non-owning handle to a value managed by Arc.
+     *
+     * A Weak does not keep the value alive and cannot be dereferenced. It has
+     * to be upgraded to an Arc first, which fails once the last Arc is gone.
+     * Use it for back-references that would otherwise form a cycle.
+     */
+    template <class T, class Deleter = DefaultDeleter<T>> class Weak {
+
+        public:
+            /// Creates an empty Weak that never upgrades.
+            Weak() noexcept = default;
+
+            Weak(Weak&& other) noexcept
+                : _data(std::exchange(other._data, nullptr)),
+                  _cb(std::exchange(other._cb, nullptr)) {
+            }
+
+            Weak(const Weak& other) noexcept
+                : _data(other._data), _cb(other._cb) {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _cb->retain_weak();
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            explicit Weak(Weak<U>&& other) noexcept
+                : _data(static_cast<T*>(std::exchange(other._data, nullptr))),
+                  _cb(std::exchange(other._cb, nullptr)) {
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            explicit Weak(const Weak<U>& other) noexcept
+                : _data(static_cast<T*>(other._data)), _cb(other._cb) {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _cb->retain_weak();
+            }
+
+            auto operator=(Weak&& other) noexcept -> Weak& {
+                if (this != &other) {
+                    this->reset();
+                    _data = std::exchange(other._data, nullptr);
+                    _cb = std::exchange(other._cb, nullptr);
+                }
+
+                return *this;
+            }
+
+            auto operator=(const Weak& other) noexcept -> Weak& {
+                if (this != &other) {
+                    this->reset();
+
+                    if (other._cb != nullptr) {
+                        other._cb->retain_weak();
+                        _data = other._data;
+                        _cb = other._cb;
+                    }
+                }
+
+                return *this;
+            }
+
+            ~Weak() noexcept {
+                this->reset();
+            }
+
+            /**
+             * @brief Attempts to obtain a strong reference.
+             * @return Some(Arc) while at least one Arc is alive, None after the
+             * value has been dropped or if this Weak is empty.
+             */
+            [[nodiscard]] auto upgrade() const noexcept
+                -> Option<Arc<T, Deleter>> {
+
+                if (_cb == nullptr || !_cb->try_retain()) return None;
+
+                return Some(Arc<T, Deleter>(_data, _cb));
+            }
+
+            auto reset() noexcept -> void {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _data = nullptr;
+                std::exchange(_cb, nullptr)->release_weak();
+            }
+
+            auto swap(Weak& other) noexcept -> void {
+                std::swap(_data, other._data);
+                std::swap(_cb, other._cb);
+            }
+
+            [[nodiscard]] auto strong_count() const noexcept -> Option<usize> {
+                if (_cb == nullptr) [[unlikely]]
+                    return None;
+
+                return Some(_cb->strong_count.load(std::memory_order_acquire));
+            }
+
+            [[nodiscard]] auto weak_count() const noexcept -> Option<usize> {
+                if (_cb == nullptr) [[unlikely]]
+                    return None;
+
+                auto weak = _cb->weak_count.load(std::memory_order_acquire);
+
+                // While the value is alive one weak reference belongs to the
+                // strong handles
+                if (_cb->strong_count.load(std::memory_order_acquire) != 0)
+                    weak -= 1;
+
+                return Some(weak);
+            }
+
+        private:
+            Weak(T* data, impl::ArcControlBlock* cb) noexcept
+                : _data(data), _cb(cb) {
+            }
+
+            template <class U, class Del> friend class Arc;
+            template <class U, class Del> friend class Weak;
+
+        private:
+            T* _data = nullptr;
+            impl::ArcControlBlock* _cb = nullptr;
+    };
+
+    /**
+     * @brief Shared immutable slice. The length is kept in the control
+     * block, so the handle stays two pointers and the counts, the length
+     * and the elements are one allocation.
+     */
+    template <class T, class Deleter> class Arc<T[], Deleter> {
+
+            using Block = impl::ArcSliceBlock<T>;
+
+        public:
+            /// Creates an empty handle that shares nothing.
+            Arc() noexcept = default;
+
+            Arc(Arc&& other) noexcept
+                : _data(std::exchange(other._data, nullptr)),
+                  _cb(std::exchange(other._cb, nullptr)) {
+            }
+
+            Arc(const Arc& other) noexcept
+                : _data(other._data), _cb(other._cb) {
+
+                if (_cb != nullptr) _cb->retain();
+            }
+
+            auto operator=(Arc&& other) noexcept -> Arc& {
+                if (this != &other) {
+                    this->reset();
+                    _data = std::exchange(other._data, nullptr);
+                    _cb = std::exchange(other._cb, nullptr);
+                }
+
+                return *this;
+            }
+
+            auto operator=(const Arc& other) noexcept -> Arc& {
+                if (this != &other) {
+                    if (other._cb != nullptr) other._cb->retain();
+
+                    this->reset();
+                    _data = other._data;
+                    _cb = other._cb;
+                }
+
+                return *this;
+            }
+
+            ~Arc() noexcept {
+                this->reset();
+            }
+
+            /// Element i is constructed in place from f(i).
+            template <class F>
+            requires std::constructible_from<T, std::invoke_result_t<F, usize>>
+            [[nodiscard]] static auto from_fn(usize len, F&& f) noexcept
+                -> Arc {
+
+                auto* cb = Block::allocate(len);
+                auto* data = cb->data();
+
+                for (auto i = usize{0}; i < len; i++)
+                    std::construct_at(data + i, f(i));
+
+                return Arc(data, cb);
+            }
+
+            [[nodiscard]] static auto copy_from(std::span<const T> values)
+                noexcept -> Arc
+            requires std::copy_constructible<T>
+            {
+                auto* cb = Block::allocate(values.size());
+                std::uninitialized_copy(values.begin(), values.end(),
+                                        cb->data());
+
+                return Arc(cb->data(), cb);
+            }
+
+            /**
+             * @brief `len` elements left uninitialized; only for trivial
+             * types. Fill them through get_mut() before sharing the Arc.
+             */
+            [[nodiscard]] static auto new_uninit(usize len) noexcept -> Arc
+            requires std::is_trivially_default_constructible_v<T>
+            {
+                auto* cb = Block::allocate(len);
+                return Arc(cb->data(), cb);
+            }
+
+            [[nodiscard]] auto operator[](usize i) const noexcept
+                -> const T& {
+
+                if (i >= this->len()) [[unlikely]]
+                    panic("Arc slice index out of bounds");
+
+                return _data[i];
+            }
+
+            [[nodiscard]] auto len() const noexcept -> usize {
+                return _cb != nullptr ? _cb->len : 0;
+            }
+
+            [[nodiscard]] auto is_empty() const noexcept -> bool {
+                return this->len() == 0;
+            }
+
+            [[nodiscard]] auto as_span() const noexcept -> std::span<const T> {
+                return {_data, this->len()};
+            }
+
+            operator std::span<const T>() const& noexcept {
+                return this->as_span();
+            }
+
+            /// The elements, if this is the only Arc sharing them.
+            [[nodiscard]] auto get_mut() noexcept -> Option<std::span<T>> {
+
+                if (_cb == nullptr || !_cb->is_unique()) return None;
+
+                return Some(std::span<T>(_data, _cb->len));
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return _cb != nullptr;
+            }
+
+            auto reset() noexcept -> void {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _data = nullptr;
+                std::exchange(_cb, nullptr)->release();
+            }
+
+            auto swap(Arc& other) noexcept -> void {
+                std::swap(_data, other._data);
+                std::swap(_cb, other._cb);
+            }
+
+            auto unsafe_get() const& noexcept -> const T* {
+                return _data;
+            }
+
+            [[nodiscard]] auto strong_count() const noexcept -> Option<usize> {
+                if (_cb == nullptr) [[unlikely]]
+                    return None;
+
+                return Some(_cb->strong_count.load(std::memory_order_acquire));
+            }
+
+        private:
+            Arc(T* data, Block* cb) noexcept : _data(data), _cb(cb) {
+            }
+
+        private:
+            T* _data = nullptr;
+            Block* _cb = nullptr;
+    };
+
 }; // namespace lx::core
+
+/// Sending the handle sends the T it gives access to
+template <class T, class Deleter>
+struct lx::trait::UnsafeSendMarker<lx::core::Arc<T, Deleter>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+template <class T, class Deleter>
+struct lx::trait::UnsafeSendMarker<lx::core::Weak<T, Deleter>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+/// An Arc never points at address 1, even when empty or moved from
+template <class T, class Deleter>
+struct lx::trait::UnsafeNicheMarker<lx::core::Arc<T, Deleter>> {
+        static constexpr auto value = true;
+        static constexpr auto offset = std::size_t{0};
+        static constexpr auto none = lx::trait::pointer_niche;
+};
+
+/// Handles are just pointers; the counts live in the control block
+template <class T, class Deleter>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<lx::core::Arc<T, Deleter>> {
+        static constexpr auto value = true;
+};
+
+template <class T, class Deleter>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<lx::core::Weak<T, Deleter>> {
+        static constexpr auto value = true;
+};
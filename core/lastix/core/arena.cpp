@@ -0,0 +1,86 @@
+#include "lastix/core/arena.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace lx::core {
+
+    Arena::Arena(usize chunk_size, usize limit) noexcept
+        : _chunk_size(chunk_size), _limit(limit) {
+    }
+
+    Arena::~Arena() noexcept {
+        while (_first != nullptr)
+            delete[] reinterpret_cast<std::byte*>(
+                std::exchange(_first, _first->next));
+    }
+
+    auto Arena::rewind(Mark mark) noexcept -> void {
+
+        if (mark._chunk == nullptr) {
+            this->reset();
+            return;
+        }
+
+        _current = mark._chunk;
+        _cursor = mark._cursor;
+        _end = _current->begin() + _current->size;
+    }
+
+    auto Arena::reset() noexcept -> void {
+
+        if (_first == nullptr) return;
+
+        this->enter(_first);
+    }
+
+    auto Arena::for_thread() noexcept -> Arena& {
+        thread_local auto arena = Arena();
+        return arena;
+    }
+
+    auto Arena::grow(usize size, usize align) noexcept -> bool {
+
+        // Room for the worst-case padding in front of the allocation
+        if (size > std::numeric_limits<usize>::max() - align) [[unlikely]]
+            return false;
+
+        auto needed = size + align - 1;
+
+        // Chunks kept by reset() or rewind() come first
+        auto* next = _current != nullptr ? _current->next : _first;
+        if (next != nullptr && next->size >= needed) {
+            this->enter(next);
+            return true;
+        }
+
+        auto chunk_size = std::max(_chunk_size, needed);
+        if (chunk_size > _limit - _capacity ||
+            chunk_size > std::numeric_limits<usize>::max() - sizeof(Chunk))
+            return false;
+
+        auto* memory = new (std::nothrow) std::byte[sizeof(Chunk) + chunk_size];
+        if (memory == nullptr) [[unlikely]]
+            return false;
+
+        // A kept chunk that was too small stays behind the new one
+        auto* chunk = new (memory) Chunk{next, chunk_size};
+
+        if (_current != nullptr)
+            _current->next = chunk;
+        else
+            _first = chunk;
+
+        _capacity += chunk_size;
+        this->enter(chunk);
+
+        return true;
+    }
+
+    auto Arena::enter(Chunk* chunk) noexcept -> void {
+        _current = chunk;
+        _cursor = chunk->begin();
+        _end = _cursor + chunk->size;
+    }
+
+}; // namespace lx::core
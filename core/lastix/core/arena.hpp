@@ -0,0 +1,386 @@
+#pragma once
+
+#include "lastix/core/diagnostics.hpp"
+#include "lastix/core/error.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/result.hpp"
+#include "lastix/trait/niche.hpp"
+#include "lastix/trait/send.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace lx::core {
+
+    class Arena;
+
+    /**
+     * @brief Owning pointer to a value in an Arena.
+     *
+     * Dropping an ArenaBox runs ~T but leaves the memory to the arena, which
+     * releases it all at once. An ArenaBox must be dropped before its arena is
+     * reset, rewound past it or destroyed.
+     */
+    template <class T> class ArenaBox {
+
+        public:
+            ArenaBox(ArenaBox&& other) noexcept
+                : _ptr(std::exchange(other._ptr, nullptr)) {
+            }
+
+            auto operator=(ArenaBox&& other) noexcept -> ArenaBox& {
+
+                if (this != &other) [[likely]] {
+                    this->reset();
+                    _ptr = std::exchange(other._ptr, nullptr);
+                }
+
+                return *this;
+            }
+
+            ~ArenaBox() noexcept {
+                this->reset();
+            }
+
+            /// Takes over a value constructed in arena memory.
+            [[nodiscard]] static auto unsafe_from_raw(T* ptr) noexcept
+                -> ArenaBox {
+                return ArenaBox(ptr);
+            }
+
+            [[nodiscard]] auto operator->() noexcept -> T* {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return _ptr;
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> const T* {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return _ptr;
+            }
+
+            [[nodiscard]] auto operator*() noexcept -> T& {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return *_ptr;
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> const T& {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return *_ptr;
+            }
+
+            explicit operator bool() const noexcept {
+                return _ptr != nullptr;
+            }
+
+            auto swap(ArenaBox& other) noexcept -> void {
+                std::swap(_ptr, other._ptr);
+            }
+
+            /// Destroys the value; the memory stays with the arena.
+            auto reset() noexcept -> void {
+                if (auto* ptr = std::exchange(_ptr, nullptr))
+                    std::destroy_at(ptr);
+            }
+
+            /// Gives up ownership without running ~T.
+            [[nodiscard]] auto release() noexcept -> T* {
+                return std::exchange(_ptr, nullptr);
+            }
+
+            auto unsafe_get() & noexcept -> T* {
+                return _ptr;
+            }
+
+            auto unsafe_get() const& noexcept -> const T* {
+                return _ptr;
+            }
+
+            ArenaBox(const ArenaBox&) = delete;
+            auto operator=(const ArenaBox&) -> ArenaBox& = delete;
+
+        private:
+            explicit ArenaBox(T* ptr) noexcept : _ptr(ptr) {
+            }
+
+        private:
+            T* _ptr = nullptr;
+    };
+
+    /**
+     * @brief Bump allocator for many short-lived objects.
+     *
+     * Memory comes from a chain of chunks of at least chunk_size bytes and is
+     * never freed one object at a time: reset() and rewind() make it
+     * reusable in one step and keep the chunks for the next round, the
+     * destructor frees them. Nothing is destroyed by the arena itself; use
+     * ArenaBox for values that need their destructor run.
+     *
+     * Running out of memory, or past `limit` bytes of chunks, is reported as
+     * an Err rather than a panic. An Arena is not thread-safe; for_thread()
+     * gives every thread one of its own.
+     */
+    class Arena {
+
+            struct Chunk;
+
+        public:
+            /// Allocation position that rewind() returns to.
+            class Mark {
+
+                private:
+                    friend class Arena;
+
+                    Mark(Chunk* chunk, std::byte* cursor) noexcept
+                        : _chunk(chunk), _cursor(cursor) {
+                    }
+
+                private:
+                    Chunk* _chunk;
+                    std::byte* _cursor;
+            };
+
+            explicit Arena(
+                usize chunk_size = 4096,
+                usize limit = std::numeric_limits<usize>::max()) noexcept;
+            ~Arena() noexcept;
+
+            Arena(const Arena&) = delete;
+            auto operator=(const Arena&) -> Arena& = delete;
+
+            /// `size` bytes aligned to `align`, which must be a power of two.
+            [[nodiscard]] auto allocate(usize size, usize align) noexcept
+                -> Result<void*, Error> {
+
+                if (align == 0 || (align & (align - 1)) != 0) [[unlikely]]
+                    panic("Arena alignment must be a power of two");
+
+                if (auto* memory = this->bump(size, align)) [[likely]]
+                    return Ok(static_cast<void*>(memory));
+
+                if (!this->grow(size, align)) [[unlikely]]
+                    return Err("Arena is out of memory");
+
+                return Ok(static_cast<void*>(this->bump(size, align)));
+            }
+
+            /// Constructs a T whose destructor is never run.
+            template <class T, class... Args>
+            requires std::constructible_from<T, Args...>
+            [[nodiscard]] auto create(Args&&... args) noexcept
+                -> Result<T*, Error> {
+
+                auto memory = this->allocate(sizeof(T), alignof(T));
+                if (memory.is_err()) [[unlikely]]
+                    return Err(std::move(memory).unwrap_err());
+
+                return Ok(std::construct_at(static_cast<T*>(memory.unwrap()),
+                                            std::forward<Args>(args)...));
+            }
+
+            /// Constructs a T that is destroyed with the returned ArenaBox.
+            template <class T, class... Args>
+            requires std::constructible_from<T, Args...>
+            [[nodiscard]] auto make(Args&&... args) noexcept
+                -> Result<ArenaBox<T>, Error> {
+
+                auto value = this->create<T>(std::forward<Args>(args)...);
+                if (value.is_err()) [[unlikely]]
+                    return Err(std::move(value).unwrap_err());
+
+                return Ok(ArenaBox<T>::unsafe_from_raw(value.unwrap()));
+            }
+
+            [[nodiscard]] auto mark() const noexcept -> Mark {
+                return Mark(_current, _cursor);
+            }
+
+            /// Releases everything allocated since `mark` was taken.
+            auto rewind(Mark mark) noexcept -> void;
+
+            /// Releases everything; the chunks are kept for reuse.
+            auto reset() noexcept -> void;
+
+            /// Bytes held in chunks, used or not.
+            [[nodiscard]] auto capacity() const noexcept -> usize {
+                return _capacity;
+            }
+
+            /// Arena of the calling thread, created on first use.
+            [[nodiscard]] static auto for_thread() noexcept -> Arena&;
+
+        private:
+            struct Chunk {
+                    Chunk* next;
+                    usize size;
+
+                    [[nodiscard]] auto begin() noexcept -> std::byte* {
+                        return reinterpret_cast<std::byte*>(this + 1);
+                    }
+            };
+
+            auto bump(usize size, usize align) noexcept -> std::byte* {
+
+                auto address = reinterpret_cast<std::uintptr_t>(_cursor);
+                auto aligned = (address + align - 1) & ~(align - 1);
+                auto end = reinterpret_cast<std::uintptr_t>(_end);
+
+                // No addition, so a huge size cannot wrap past the end
+                if (_cursor == nullptr || aligned > end ||
+                    size > end - aligned) [[unlikely]]
+                    return nullptr;
+
+                _cursor = reinterpret_cast<std::byte*>(aligned) + size;
+                return reinterpret_cast<std::byte*>(aligned);
+            }
+
+            /// Moves on to a chunk that fits size bytes at align.
+            auto grow(usize size, usize align) noexcept -> bool;
+
+            auto enter(Chunk* chunk) noexcept -> void;
+
+        private:
+            Chunk* _first = nullptr;
+            Chunk* _current = nullptr;
+            std::byte* _cursor = nullptr;
+            std::byte* _end = nullptr;
+            usize _chunk_size;
+            usize _limit;
+            usize _capacity = 0;
+    };
+
+    /**
+     * @brief Standard allocator over an Arena, for Box::new_in() and std
+     * containers. deallocate() is a no-op and allocate() panics when the
+     * arena is exhausted, as allocators cannot return an error.
+     */
+    template <class T> class ArenaAllocator {
+
+        public:
+            using value_type = T;
+
+            ArenaAllocator(Arena& arena) noexcept : _arena(&arena) {
+            }
+
+            template <class U>
+            ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+                : _arena(other._arena) {
+            }
+
+            [[nodiscard]] auto allocate(usize n) noexcept -> T* {
+
+                if (n > std::numeric_limits<usize>::max() / sizeof(T))
+                    [[unlikely]]
+                    panic("ArenaAllocator request overflows");
+
+                return static_cast<T*>(
+                    _arena->allocate(n * sizeof(T), alignof(T))
+                        .expect("Arena is out of memory"));
+            }
+
+            auto deallocate(T*, usize) noexcept -> void {
+            }
+
+            template <class U>
+            auto operator==(const ArenaAllocator<U>& other) const noexcept
+                -> bool {
+                return _arena == other._arena;
+            }
+
+        private:
+            template <class U> friend class ArenaAllocator;
+
+            Arena* _arena;
+    };
+
+    /**
+     * @brief Arena for Error context frames.
+     *
+     * While a Scope is active on a thread, Error::context() on that thread
+     * places messages and frame arrays in the arena instead of allocating
+     * them one by one. reset() and the destructor release everything at
+     * once; both panic if an Error still uses the arena. Errors that use an
+     * arena must be dropped on the arena's thread.
+     *
+     * The memory is managed by an Arena. This class only adds the current
+     * arena of each thread and a count of the Errors using it.
+     */
+    class ErrorArena {
+
+        public:
+            /// Makes an arena the current one of its thread until destroyed.
+            class Scope {
+
+                public:
+                    explicit Scope(ErrorArena& arena) noexcept;
+                    ~Scope() noexcept;
+
+                    Scope(const Scope&) = delete;
+                    auto operator=(const Scope&) -> Scope& = delete;
+
+                private:
+                    ErrorArena* _previous;
+            };
+
+            explicit ErrorArena(usize chunk_size = 4096) noexcept;
+            ~ErrorArena() noexcept;
+
+            ErrorArena(const ErrorArena&) = delete;
+            auto operator=(const ErrorArena&) -> ErrorArena& = delete;
+
+            [[nodiscard]] auto enter() noexcept -> Scope {
+                return Scope(*this);
+            }
+
+            /// Releases everything; the chunks are kept for reuse.
+            auto reset() noexcept -> void;
+
+            /// The arena of the innermost active Scope on this thread.
+            [[nodiscard]] static auto current() noexcept -> ErrorArena*;
+
+            /// Panics when out of memory, like the heap it replaces.
+            [[nodiscard]] auto allocate(usize size, usize align) noexcept
+                -> void* {
+                return _arena.allocate(size, align)
+                    .expect("ErrorArena is out of memory");
+            }
+
+        private:
+            friend class Error;
+
+            Arena _arena;
+
+            /// Errors whose context lives here.
+            usize _users = 0;
+    };
+
+}; // namespace lx::core
+
+/// Sending an ArenaBox sends the T it owns
+template <class T>
+struct lx::trait::UnsafeSendMarker<lx::core::ArenaBox<T>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+/// An ArenaBox never points at address 1, even when empty or moved from
+template <class T>
+struct lx::trait::UnsafeNicheMarker<lx::core::ArenaBox<T>> {
+        static constexpr auto value = true;
+        static constexpr auto offset = std::size_t{0};
+        static constexpr auto none = lx::trait::pointer_niche;
+};
@@ -0,0 +1,445 @@
+#pragma once
+
+#include "lastix/core/arc.hpp"
+#include "lastix/core/diagnostics.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/sync/mutex.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace lx::core {
+
+    namespace impl {
+
+        /**
+         * @brief Whether AtomicArc packs its slot into one 64-bit word.
+         *
+         * The packed slot needs every control block address to fit in 48
+         * bits, which the LASTIX_ATOMIC_ARC_PACKED configure check vouches
+         * for. 32-bit targets always qualify.
+         */
+#ifdef LASTIX_ATOMIC_ARC_PACKED
+        inline constexpr auto pack_atomic_arc = true;
+#else
+        inline constexpr auto pack_atomic_arc = sizeof(void*) == 4;
+#endif
+
+        /**
+         * @brief Atomically replaceable Arc, shared by AtomicArc and
+         * AtomicOption<Arc>.
+         *
+         * The slot packs the control block pointer and a count of references
+         * handed out to readers into one 64-bit word. Whenever an Arc is
+         * stored, the slot pre-pays `batch` strong references on its control
+         * block. A reader claims one of them with a single fetch_add on the
+         * word, so load() never retries and never touches the control block.
+         * Only when half of the batch has been handed out does a reader top it
+         * up again.
+         *
+         * Whoever replaces the block (store, exchange, destructor) gives back
+         * the pre-paid references readers have not claimed.
+         *
+         * Readers rebuild the value pointer from the control block. An Arc
+         * whose value pointer is elsewhere (a base class at a non-zero
+         * offset) is stored boxed instead: the word points at a block of our
+         * own holding that Arc, and load() copies it out.
+         */
+        template <class T, class Deleter, bool Packed> class AtomicArcSlot {
+
+            public:
+                explicit AtomicArcSlot(Arc<T, Deleter> arc) noexcept
+                    : _state(adopt(std::move(arc))) {
+                }
+
+                AtomicArcSlot(const AtomicArcSlot&) = delete;
+                auto operator=(const AtomicArcSlot&) -> AtomicArcSlot& = delete;
+
+                ~AtomicArcSlot() noexcept {
+                    release(_state.load(std::memory_order_acquire));
+                }
+
+                [[nodiscard]] auto load() const noexcept -> Arc<T, Deleter> {
+                    return take(this->claim());
+                }
+
+                auto exchange(Arc<T, Deleter> arc) noexcept -> Arc<T, Deleter> {
+
+                    auto state = _state.exchange(adopt(std::move(arc)),
+                                                 std::memory_order_acq_rel);
+                    auto* cb = block(state);
+
+                    if (cb == nullptr) return null();
+
+                    // Keep one of the remaining references for the caller
+                    auto owned = batch - local(state);
+                    if (owned > 1) cb->release(owned - 1);
+
+                    return take(state);
+                }
+
+                auto store(Arc<T, Deleter> arc) noexcept -> void {
+                    release(_state.exchange(adopt(std::move(arc)),
+                                            std::memory_order_acq_rel));
+                }
+
+                auto compare_exchange(Arc<T, Deleter>& expected,
+                                      Arc<T, Deleter> desired) noexcept
+                    -> bool {
+
+                    auto next = adopt(std::move(desired));
+
+                    // The claimed reference keeps the block from being freed
+                    // and its address reused while we compare against it
+                    auto seen = this->claim();
+                    auto* cb = block(seen);
+
+                    if (holds(seen, expected)) {
+                        // Readers bump the local count, so retry until either
+                        // the block changes or the swap goes through
+                        auto state = seen;
+                        while (block(state) == cb) {
+                            if (_state.compare_exchange_weak(
+                                    state, next, std::memory_order_acq_rel,
+                                    std::memory_order_relaxed)) {
+                                release(state);
+                                if (cb != nullptr) cb->release();
+                                return true;
+                            }
+                        }
+
+                        // A writer got there first: report its value
+                        if (cb != nullptr) cb->release();
+                        seen = this->claim();
+                    }
+
+                    release(next);
+                    expected = take(seen);
+                    return false;
+                }
+
+                [[nodiscard]] static auto null() noexcept -> Arc<T, Deleter> {
+                    return Arc<T, Deleter>(nullptr, nullptr);
+                }
+
+            private:
+                static_assert(std::atomic<u64>::is_always_lock_free);
+
+                // Control blocks fit in 48 bits where pack_atomic_arc holds;
+                // on 32-bit targets the whole upper half holds the local count
+                static constexpr auto pointer_bits =
+                    sizeof(void*) == 8 ? usize{48} : usize{32};
+                static constexpr auto local_one = u64{1} << pointer_bits;
+                static constexpr auto pointer_mask = local_one - 1;
+
+                // The local count must never reach the batch: a handed out
+                // reference that was not pre-paid is never counted
+                static constexpr auto batch =
+                    sizeof(void*) == 8 ? usize{1} << 16 : usize{1} << 20;
+                static constexpr auto refill_at = batch / 2;
+
+                /// Control block holding an Arc that could not be stored as is.
+                using Boxed = ArcInplaceBlock<Arc<T, Deleter>>;
+
+                // Control blocks are at least pointer-aligned, which leaves
+                // the lowest bit of the address free to mark a Boxed block
+                static_assert(alignof(ArcControlBlock) > 1);
+                static constexpr auto boxed = u64{1};
+
+                static auto block(u64 state) noexcept -> ArcControlBlock* {
+                    return reinterpret_cast<ArcControlBlock*>(
+                        static_cast<std::uintptr_t>(state & pointer_mask &
+                                                    ~boxed));
+                }
+
+                static auto is_boxed(u64 state) noexcept -> bool {
+                    return (state & boxed) != 0;
+                }
+
+                static auto local(u64 state) noexcept -> usize {
+                    return static_cast<usize>(state >> pointer_bits);
+                }
+
+                /// Takes over the Arc's reference and pre-pays a batch.
+                static auto adopt(Arc<T, Deleter>&& arc) noexcept -> u64 {
+
+                    if (arc._cb == nullptr) return 0;
+
+                    auto* cb = arc._cb;
+                    auto tag = u64{0};
+
+                    if (static_cast<const void*>(arc._data) != cb->object())
+                        [[unlikely]] {
+                        cb = new Boxed(std::move(arc));
+                        tag = boxed;
+                    } else {
+                        arc._data = nullptr;
+                        arc._cb = nullptr;
+                    }
+
+                    // Ruled out by the configure check; a process that tags
+                    // heap pointers at run time has to turn the option off
+                    auto address = reinterpret_cast<std::uintptr_t>(cb);
+                    if ((address & ~pointer_mask) != 0) [[unlikely]]
+                        panic("AtomicArc control block address does not fit "
+                              "the packed slot, build with "
+                              "LASTIX_ATOMIC_ARC_PACKED=OFF");
+
+                    cb->retain(batch - 1);
+                    return static_cast<u64>(address) | tag;
+                }
+
+                /// Claims one pre-paid reference on the current block.
+                auto claim() const noexcept -> u64 {
+
+                    auto state =
+                        _state.fetch_add(local_one, std::memory_order_acquire) +
+                        local_one;
+
+                    if (local(state) >= refill_at) [[unlikely]]
+                        refill(block(state), state);
+
+                    return state;
+                }
+
+                /// The Arc stored in `state`, for one reference on its block.
+                static auto take(u64 state) noexcept -> Arc<T, Deleter> {
+
+                    auto* cb = block(state);
+                    if (cb == nullptr) return null();
+
+                    if (is_boxed(state)) [[unlikely]] {
+                        auto arc = static_cast<Boxed*>(cb)->value;
+                        cb->release();
+                        return arc;
+                    }
+
+                    return Arc<T, Deleter>(static_cast<T*>(cb->object()), cb);
+                }
+
+                /// Whether `state` stores `arc`. Needs a claimed reference.
+                static auto holds(u64 state,
+                                  const Arc<T, Deleter>& arc) noexcept -> bool {
+
+                    auto* cb = block(state);
+
+                    if (is_boxed(state)) [[unlikely]] {
+                        const auto& stored = static_cast<Boxed*>(cb)->value;
+                        return stored._cb == arc._cb &&
+                               stored._data == arc._data;
+                    }
+
+                    if (cb != arc._cb) return false;
+
+                    return cb == nullptr ||
+                           cb->object() == static_cast<const void*>(arc._data);
+                }
+
+                /// Gives back every reference the slot still owns.
+                static auto release(u64 state) noexcept -> void {
+                    if (auto* cb = block(state))
+                        cb->release(batch - local(state));
+                }
+
+                /**
+                 * @brief Pre-pays another refill_at references and takes the
+                 * same amount off the local count.
+                 *
+                 * If the block was replaced meanwhile, its new owner already
+                 * settled the local count, so the extra references are
+                 * returned. The same block stored again is fine: pre-paid
+                 * references are per block, not per store.
+                 */
+                auto refill(ArcControlBlock* cb, u64 state) const noexcept
+                    -> void {
+
+                    if (cb != nullptr) cb->retain(refill_at);
+
+                    while (block(state) == cb && local(state) >= refill_at) {
+                        if (_state.compare_exchange_weak(
+                                state, state - refill_at * local_one,
+                                std::memory_order_release,
+                                std::memory_order_relaxed))
+                            return;
+                    }
+
+                    if (cb != nullptr) cb->release(refill_at);
+                }
+
+            private:
+                mutable std::atomic<u64> _state;
+        };
+
+        /**
+         * @brief Fallback for targets where addresses may not fit the packed
+         * word: the Arc sits behind a lock. Readers copy it out, so the lock
+         * is only held for one reference count increment.
+         */
+        template <class T, class Deleter>
+        class AtomicArcSlot<T, Deleter, false> {
+
+            public:
+                explicit AtomicArcSlot(Arc<T, Deleter> arc) noexcept
+                    : _arc(std::move(arc)) {
+                }
+
+                AtomicArcSlot(const AtomicArcSlot&) = delete;
+                auto operator=(const AtomicArcSlot&) -> AtomicArcSlot& = delete;
+
+                [[nodiscard]] auto load() const noexcept -> Arc<T, Deleter> {
+                    _lock.lock();
+                    auto arc = _arc;
+                    _lock.unlock();
+
+                    return arc;
+                }
+
+                auto exchange(Arc<T, Deleter> arc) noexcept -> Arc<T, Deleter> {
+                    _lock.lock();
+                    _arc.swap(arc);
+                    _lock.unlock();
+
+                    return arc;
+                }
+
+                auto store(Arc<T, Deleter> arc) noexcept -> void {
+                    // The previous value is dropped after unlocking
+                    static_cast<void>(this->exchange(std::move(arc)));
+                }
+
+                auto compare_exchange(Arc<T, Deleter>& expected,
+                                      Arc<T, Deleter> desired) noexcept
+                    -> bool {
+
+                    _lock.lock();
+
+                    if (_arc._cb == expected._cb &&
+                        _arc._data == expected._data) {
+                        _arc.swap(desired);
+                        _lock.unlock();
+                        return true;
+                    }
+
+                    auto current = _arc;
+                    _lock.unlock();
+
+                    expected = std::move(current);
+                    return false;
+                }
+
+                [[nodiscard]] static auto null() noexcept -> Arc<T, Deleter> {
+                    return Arc<T, Deleter>(nullptr, nullptr);
+                }
+
+            private:
+                mutable lx::sync::impl::RawMutex _lock;
+                Arc<T, Deleter> _arc;
+        };
+
+        template <class T, class Deleter>
+        using ArcSlot = AtomicArcSlot<T, Deleter, pack_atomic_arc>;
+
+    }; // namespace impl
+
+    /**
+     * @brief Arc that can be loaded and replaced concurrently without a lock.
+     *
+     * Meant for read-mostly shared state such as configuration snapshots:
+     * readers call load() and keep the returned Arc as long as they need the
+     * snapshot, a writer publishes a new one with store(). load() is a single
+     * atomic RMW on the slot.
+     *
+     * The pre-paid references show up in strong_count() of a stored value.
+     *
+     * Without the LASTIX_ATOMIC_ARC_PACKED configure check (targets whose
+     * addresses may exceed 48 bits or carry tags) the slot is a short lock
+     * around an Arc instead.
+     */
+    template <class T, class Deleter = DefaultDeleter<T>> class AtomicArc {
+
+        public:
+            explicit AtomicArc(Arc<T, Deleter> arc) noexcept
+                : _slot(std::move(arc)) {
+            }
+
+            [[nodiscard]] auto load() const noexcept -> Arc<T, Deleter> {
+                return _slot.load();
+            }
+
+            auto store(Arc<T, Deleter> arc) noexcept -> void {
+                _slot.store(std::move(arc));
+            }
+
+            /// Replaces the stored Arc and returns the previous one.
+            auto exchange(Arc<T, Deleter> arc) noexcept -> Arc<T, Deleter> {
+                return _slot.exchange(std::move(arc));
+            }
+
+            /**
+             * @brief Stores `desired` if the slot still holds the value of
+             * `expected`. On failure `expected` is replaced with the current
+             * value and `desired` is dropped.
+             */
+            auto compare_exchange(Arc<T, Deleter>& expected,
+                                  Arc<T, Deleter> desired) noexcept -> bool {
+                return _slot.compare_exchange(expected, std::move(desired));
+            }
+
+        private:
+            impl::ArcSlot<T, Deleter> _slot;
+    };
+
+    template <class T> class AtomicOption;
+
+    /// AtomicArc that may also be empty.
+    template <class T, class Deleter> class AtomicOption<Arc<T, Deleter>> {
+
+        public:
+            AtomicOption(Option<Arc<T, Deleter>> value) noexcept
+                : _slot(into_arc(std::move(value))) {
+            }
+
+            [[nodiscard]] auto load() const noexcept
+                -> Option<Arc<T, Deleter>> {
+                return into_option(_slot.load());
+            }
+
+            auto store(Option<Arc<T, Deleter>> value) noexcept -> void {
+                _slot.store(into_arc(std::move(value)));
+            }
+
+            auto exchange(Option<Arc<T, Deleter>> value) noexcept
+                -> Option<Arc<T, Deleter>> {
+                return into_option(_slot.exchange(into_arc(std::move(value))));
+            }
+
+            /// Empties the slot and returns what it held.
+            auto take() noexcept -> Option<Arc<T, Deleter>> {
+                return this->exchange(None);
+            }
+
+        private:
+            static auto into_arc(Option<Arc<T, Deleter>> value) noexcept
+                -> Arc<T, Deleter> {
+
+                if (value.is_none())
+                    return impl::ArcSlot<T, Deleter>::null();
+
+                return std::move(value).unwrap();
+            }
+
+            static auto into_option(Arc<T, Deleter> arc) noexcept
+                -> Option<Arc<T, Deleter>> {
+
+                if (!arc) return None;
+
+                return Some(std::move(arc));
+            }
+
+        private:
+            impl::ArcSlot<T, Deleter> _slot;
+    };
+
+}; // namespace lx::core
@@ -2,21 +2,40 @@
 
 #include "lastix/core/diagnostics.hpp"
 #include "lastix/core/memory.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/trait/niche.hpp"
+#include "lastix/trait/relocatable.hpp"
+#include "lastix/trait/send.hpp"
+#include <concepts>
+#include <memory>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace lx::core {
 
+    /**
+     * @brief Owning pointer. The deleter is stored next to the pointer but
+     * takes no space when it is stateless, so Box<T> is pointer-sized.
+     */
     template <class T, class Deleter = DefaultDeleter<T>> class Box {
 
         public:
+            // Box arguments are rejected before T is looked at, so copying a
+            // Box<T> is diagnosed even while T is incomplete
             template <class... Args>
-            requires std::constructible_from<T, Args...>
+            requires(!std::same_as<std::remove_cvref_t<Args>, Box> && ...) &&
+                    std::constructible_from<T, Args...>
             explicit Box(Args &&...args) noexcept
                 : _ptr(new T(std::forward<Args>(args)...)) {
             }
 
+            // Box<U> memory comes from new and goes to delete, which only
+            // our default deleter agrees with: an allocator would be handed
+            // memory it never gave out, and of the wrong size
             template <class U>
-            requires std::derived_from<U, T>
+            requires std::derived_from<U, T> &&
+                     std::same_as<Deleter, DefaultDeleter<T>>
             Box(Box<U> &&other) noexcept : _ptr(other.release()) {
             }
 
@@ -24,17 +43,41 @@ namespace lx::core {
                 this->reset();
             }
 
-            Box(Box &&box) noexcept : _ptr(box.release()) {
+            Box(Box &&box) noexcept
+                : _ptr(box.release()), _deleter(std::move(box._deleter)) {
             }
 
-            [[nodiscard]] static auto unsafe_from_raw(T *ptr)
+            [[nodiscard]] static auto unsafe_from_raw(T *ptr,
+                                                      Deleter deleter = {})
                 -> Box<T, Deleter> {
 
-                return Box<T, Deleter>(ptr);
+                return Box<T, Deleter>(ptr, std::move(deleter));
+            }
+
+            /**
+             * @brief Constructs T in memory from alloc. The Box keeps a copy
+             * of the allocator to free the value with.
+             */
+            template <class Alloc, class... Args>
+            requires std::constructible_from<T, Args...>
+            [[nodiscard]] static auto new_in(const Alloc &alloc,
+                                             Args &&...args) noexcept
+                -> Box<T, AllocatorDeleter<T, Alloc>> {
+
+                using BoxDeleter = AllocatorDeleter<T, Alloc>;
+                using Allocator = typename BoxDeleter::Allocator;
+                using Traits = std::allocator_traits<Allocator>;
+
+                auto deleter = BoxDeleter{Allocator(alloc)};
+                auto *ptr = Traits::allocate(deleter.alloc, 1);
+                std::construct_at(ptr, std::forward<Args>(args)...);
+
+                return Box<T, BoxDeleter>(ptr, std::move(deleter));
             }
 
             template <class U>
-            requires std::derived_from<U, T>
+            requires std::derived_from<U, T> &&
+                     std::same_as<Deleter, DefaultDeleter<T>>
             auto operator=(Box<U> &&other) noexcept -> Box & {
 
                 this->reset();
@@ -49,6 +92,7 @@ namespace lx::core {
 
                     this->reset();
                     _ptr = box.release();
+                    _deleter = std::move(box._deleter);
                 }
 
                 return *this;
@@ -93,11 +137,12 @@ namespace lx::core {
 
             auto swap(Box &other) noexcept -> void {
                 std::swap(_ptr, other._ptr);
+                std::swap(_deleter, other._deleter);
             }
 
             auto reset() noexcept -> void {
 
-                Deleter{}(std::exchange(_ptr, nullptr));
+                _deleter(std::exchange(_ptr, nullptr));
             }
 
             [[nodiscard]] auto release() noexcept -> T * {
@@ -119,11 +164,208 @@ namespace lx::core {
             auto operator=(const Box &) -> Box & = delete;
 
         private:
-            Box(T *ptr) : _ptr(ptr) {
+            Box(T *ptr, Deleter deleter) noexcept
+                : _ptr(ptr), _deleter(std::move(deleter)) {
             }
 
+            template <class U, class Del> friend class Box;
+
         private:
+            // First, so that the niche sits at offset 0
             T *_ptr = nullptr;
+            [[no_unique_address]] Deleter _deleter;
+    };
+
+    /**
+     * @brief Owned slice of `len()` elements, freed with the deleter.
+     * Indexing is bounds-checked.
+     *
+     * With the default deleter the elements live in storage from
+     * std::allocator<T> and are built in place, so T needs no default
+     * constructor; a deleter that takes the length is handed `len()`.
+     */
+    template <class T, class Deleter> class Box<T[], Deleter> {
+
+        public:
+            /// Creates an empty slice that owns nothing.
+            Box() noexcept = default;
+
+            ~Box() noexcept {
+                this->reset();
+            }
+
+            Box(Box &&box) noexcept
+                : _ptr(std::exchange(box._ptr, nullptr)),
+                  _len(std::exchange(box._len, 0)),
+                  _deleter(std::move(box._deleter)) {
+            }
+
+            auto operator=(Box &&box) noexcept -> Box & {
+
+                if (this != &box) [[likely]] {
+
+                    this->reset();
+                    _ptr = std::exchange(box._ptr, nullptr);
+                    _len = std::exchange(box._len, 0);
+                    _deleter = std::move(box._deleter);
+                }
+
+                return *this;
+            }
+
+            /**
+             * @brief Takes over `len` elements allocated the way Deleter
+             * frees; for the default one, `len` live elements in
+             * std::allocator<T>().allocate(len).
+             */
+            [[nodiscard]] static auto unsafe_from_raw(T *ptr, usize len,
+                                                      Deleter deleter = {})
+                -> Box {
+
+                return Box(ptr, len, std::move(deleter));
+            }
+
+            /// `len` elements left uninitialized; only for trivial types.
+            [[nodiscard]] static auto new_uninit(usize len) noexcept -> Box
+            requires std::same_as<Deleter, DefaultDeleter<T[]>> &&
+                     std::is_trivially_default_constructible_v<T>
+            {
+                auto *ptr = std::allocator<T>().allocate(len);
+                std::uninitialized_default_construct_n(ptr, len);
+
+                return Box(ptr, len, Deleter{});
+            }
+
+            /// Element i is constructed in place from f(i).
+            template <class F>
+            requires std::same_as<Deleter, DefaultDeleter<T[]>> &&
+                     std::constructible_from<T, std::invoke_result_t<F, usize>>
+            [[nodiscard]] static auto from_fn(usize len, F &&f) noexcept
+                -> Box {
+
+                auto *ptr = std::allocator<T>().allocate(len);
+                for (auto i = usize{0}; i < len; i++)
+                    std::construct_at(ptr + i, f(i));
+
+                return Box(ptr, len, Deleter{});
+            }
+
+            [[nodiscard]] static auto copy_from(std::span<const T> values)
+                noexcept -> Box
+            requires std::same_as<Deleter, DefaultDeleter<T[]>> &&
+                     std::copy_constructible<T>
+            {
+                return from_fn(values.size(),
+                               [&](usize i) -> const T & { return values[i]; });
+            }
+
+            [[nodiscard]] auto operator[](usize i) noexcept -> T & {
+
+                if (i >= _len) [[unlikely]]
+                    panic("Box slice index out of bounds");
+
+                return _ptr[i];
+            }
+
+            [[nodiscard]] auto operator[](usize i) const noexcept
+                -> const T & {
+
+                if (i >= _len) [[unlikely]]
+                    panic("Box slice index out of bounds");
+
+                return _ptr[i];
+            }
+
+            [[nodiscard]] auto len() const noexcept -> usize {
+                return _len;
+            }
+
+            [[nodiscard]] auto is_empty() const noexcept -> bool {
+                return _len == 0;
+            }
+
+            [[nodiscard]] auto as_span() noexcept -> std::span<T> {
+                return {_ptr, _len};
+            }
+
+            [[nodiscard]] auto as_span() const noexcept -> std::span<const T> {
+                return {_ptr, _len};
+            }
+
+            operator std::span<T>() & noexcept {
+                return this->as_span();
+            }
+
+            operator std::span<const T>() const & noexcept {
+                return this->as_span();
+            }
+
+            explicit operator bool() const noexcept {
+                return _ptr != nullptr;
+            }
+
+            auto swap(Box &other) noexcept -> void {
+                std::swap(_ptr, other._ptr);
+                std::swap(_len, other._len);
+                std::swap(_deleter, other._deleter);
+            }
+
+            auto reset() noexcept -> void {
+
+                auto len = std::exchange(_len, 0);
+
+                if constexpr (std::is_invocable_v<Deleter &, T *, usize>)
+                    _deleter(std::exchange(_ptr, nullptr), len);
+                else
+                    _deleter(std::exchange(_ptr, nullptr));
+            }
+
+            /// Gives up ownership; the caller frees the elements.
+            [[nodiscard]] auto release() noexcept -> std::span<T> {
+                return {std::exchange(_ptr, nullptr), std::exchange(_len, 0)};
+            }
+
+            auto unsafe_get() & noexcept -> T * {
+                return _ptr;
+            }
+
+            auto unsafe_get() const & noexcept -> const T * {
+                return _ptr;
+            }
+
+            Box(const Box &) = delete;
+            auto operator=(const Box &) -> Box & = delete;
+
+        private:
+            Box(T *ptr, usize len, Deleter deleter) noexcept
+                : _ptr(ptr), _len(len), _deleter(std::move(deleter)) {
+            }
+
+        private:
+            // First, so that the niche sits at offset 0
+            T *_ptr = nullptr;
+            usize _len = 0;
+            [[no_unique_address]] Deleter _deleter;
     };
 
 }; // namespace lx::core
+
+/// Sending a Box sends the T it owns
+template <class T, class Deleter>
+struct lx::trait::UnsafeSendMarker<lx::core::Box<T, Deleter>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+/// A Box never points at address 1, even when empty or moved from
+template <class T, class Deleter>
+struct lx::trait::UnsafeNicheMarker<lx::core::Box<T, Deleter>> {
+        static constexpr auto value = true;
+        static constexpr auto offset = std::size_t{0};
+        static constexpr auto none = lx::trait::pointer_niche;
+};
+
+/// A Box is a pointer and its deleter, which usually takes no space
+template <class T, class Deleter>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<lx::core::Box<T, Deleter>> {
+        static constexpr auto value = lx::trait::TriviallyRelocatable<Deleter>;
+};
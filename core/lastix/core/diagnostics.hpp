@@ -5,6 +5,13 @@
 
 namespace lx::core {
 
+    /**
+     * @brief Reports msg with its location and aborts.
+     *
+     * Deliberately not constexpr: reaching a panic while a constexpr
+     * function is constant-evaluated makes the expression non-constant,
+     * which turns the failed check into a compile error.
+     */
     [[noreturn]] auto
         panic(std::string_view msg,
               std::source_location loc = std::source_location::current())
@@ -0,0 +1,225 @@
+#include "lastix/core/epoch.hpp"
+
+#include <utility>
+
+namespace lx::core {
+
+    namespace {
+
+        /// Retired objects a thread collects before it tries to reclaim.
+        constexpr auto collect_threshold = usize{64};
+
+        /// Retire lists left behind by exited threads.
+        struct Orphan {
+                Orphan* next;
+                std::vector<impl::Retired> retired;
+        };
+
+        std::atomic<u64> global_epoch = 0;
+        std::atomic<impl::EpochRecord*> records = nullptr;
+        std::atomic<Orphan*> orphans = nullptr;
+
+        auto acquire_record() noexcept -> impl::EpochRecord* {
+
+            for (auto* record = records.load(std::memory_order_acquire);
+                 record != nullptr; record = record->next) {
+
+                auto used = false;
+                if (record->in_use.compare_exchange_strong(
+                        used, true, std::memory_order_acquire,
+                        std::memory_order_relaxed))
+                    return record;
+            }
+
+            auto* record = new impl::EpochRecord();
+            record->next = records.load(std::memory_order_relaxed);
+
+            while (!records.compare_exchange_weak(record->next, record,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            }
+
+            return record;
+        }
+
+        /**
+         * @brief Moves the global epoch on if every pinned thread has seen
+         * the current one.
+         */
+        auto try_advance() noexcept -> void {
+
+            auto epoch = global_epoch.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            for (auto* record = records.load(std::memory_order_acquire);
+                 record != nullptr; record = record->next) {
+
+                auto state = record->state.load(std::memory_order_relaxed);
+                if ((state & 1) != 0 && (state >> 1) != epoch) return;
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            global_epoch.compare_exchange_strong(epoch, epoch + 1,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed);
+        }
+
+        /// Destroys the expired entries and keeps the rest.
+        auto reclaim(std::vector<impl::Retired>& retired) noexcept -> void {
+
+            auto epoch = global_epoch.load(std::memory_order_acquire);
+
+            // A deleter may retire more objects into the same list
+            auto pending = std::exchange(retired, {});
+
+            for (auto& entry : pending) {
+                if (epoch - entry.epoch >= 2)
+                    entry.drop(entry.ptr);
+                else
+                    retired.push_back(entry);
+            }
+        }
+
+        auto push_orphan(Orphan* orphan) noexcept -> void {
+
+            orphan->next = orphans.load(std::memory_order_relaxed);
+            while (!orphans.compare_exchange_weak(orphan->next, orphan,
+                                                  std::memory_order_release,
+                                                  std::memory_order_relaxed)) {
+            }
+        }
+
+        auto reclaim_orphans() noexcept -> void {
+
+            // Taking the whole list at once rules out ABA on its head
+            auto* orphan = orphans.exchange(nullptr, std::memory_order_acquire);
+
+            while (orphan != nullptr) {
+                auto* next = orphan->next;
+
+                reclaim(orphan->retired);
+                if (orphan->retired.empty())
+                    delete orphan;
+                else
+                    push_orphan(orphan);
+
+                orphan = next;
+            }
+        }
+
+        auto collect_record(impl::EpochRecord& record) noexcept -> void {
+            try_advance();
+            reclaim(record.retired);
+            reclaim_orphans();
+        }
+
+        /// Two steps put everything retired before the call out of reach.
+        auto advance_twice() noexcept -> void {
+            try_advance();
+            try_advance();
+        }
+
+        /**
+         * @brief Reclaims the lists of exited threads at program exit. The
+         * main thread's record is released before static objects are
+         * destroyed, so its list is among them.
+         */
+        struct OrphanDrain {
+                ~OrphanDrain() noexcept {
+                    advance_twice();
+                    reclaim_orphans();
+                }
+        } orphan_drain;
+
+        /// The calling thread's record, handed back when the thread exits.
+        class LocalRecord {
+
+            public:
+                LocalRecord() noexcept : _record(acquire_record()) {
+                }
+
+                ~LocalRecord() noexcept {
+                    collect_record(*_record);
+
+                    if (!_record->retired.empty())
+                        push_orphan(new Orphan{
+                            nullptr, std::exchange(_record->retired, {})});
+
+                    _record->in_use.store(false, std::memory_order_release);
+                }
+
+                LocalRecord(const LocalRecord&) = delete;
+                auto operator=(const LocalRecord&) -> LocalRecord& = delete;
+
+                [[nodiscard]] auto get() const noexcept
+                    -> impl::EpochRecord& {
+                    return *_record;
+                }
+
+            private:
+                impl::EpochRecord* _record;
+        };
+
+        auto local_record() noexcept -> impl::EpochRecord& {
+            thread_local auto local = LocalRecord();
+            return local.get();
+        }
+
+    }; // namespace
+
+    auto Epoch::pin() noexcept -> Guard {
+
+        auto& record = local_record();
+
+        if (record.depth++ == 0) {
+            auto epoch = global_epoch.load(std::memory_order_relaxed);
+            record.state.store(epoch << 1 | 1, std::memory_order_relaxed);
+
+            // Publish the pin before reading anything it protects
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        return Guard(record);
+    }
+
+    auto Epoch::collect() noexcept -> void {
+        collect_record(local_record());
+    }
+
+    auto Epoch::flush() noexcept -> void {
+        auto& record = local_record();
+
+        advance_twice();
+        reclaim(record.retired);
+        reclaim_orphans();
+    }
+
+    auto Epoch::pending() noexcept -> usize {
+        return local_record().retired.size();
+    }
+
+    Epoch::Guard::~Guard() noexcept {
+        if (--_record.depth == 0)
+            _record.state.store(0, std::memory_order_release);
+    }
+
+    auto Epoch::Guard::flush() const noexcept -> void {
+        collect_record(_record);
+    }
+
+    auto Epoch::Guard::defer(void* ptr,
+                             auto (*drop)(void*) noexcept -> void) const
+        noexcept -> void {
+
+        // Readers that could still see ptr are pinned at or before the
+        // epoch read here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto epoch = global_epoch.load(std::memory_order_relaxed);
+
+        _record.retired.push_back(impl::Retired{ptr, drop, epoch});
+
+        if (_record.retired.size() >= collect_threshold) [[unlikely]]
+            collect_record(_record);
+    }
+
+}; // namespace lx::core
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "lastix/core/memory.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/trait/send.hpp"
+
+#include <atomic>
+#include <vector>
+
+namespace lx::core {
+
+    namespace impl {
+
+        /// An object waiting until no thread can still be reading it.
+        struct Retired {
+                void* ptr;
+                auto (*drop)(void* ptr) noexcept -> void;
+                u64 epoch;
+        };
+
+        /**
+         * @brief A thread's entry in the epoch registry. Records are never
+         * freed: when a thread exits, the next new thread takes its record
+         * over.
+         */
+        struct EpochRecord {
+                /// Epoch the thread is pinned in, shifted left, | 1 if pinned.
+                std::atomic<u64> state = 0;
+                std::atomic<bool> in_use = true;
+
+                /// Set once before the record is published.
+                EpochRecord* next = nullptr;
+
+                // Only touched by the owning thread
+                usize depth = 0;
+                std::vector<Retired> retired;
+        };
+
+    }; // namespace impl
+
+    /**
+     * @brief Epoch-based reclamation for lock-free data structures.
+     *
+     * Readers pin the current epoch for as long as they hold pointers into
+     * a shared structure; pinning touches only the thread's own record. A
+     * writer that unlinks a node retires it instead of deleting it. The node
+     * is destroyed, through its Deleter, once the global epoch has moved two
+     * steps past the retirement, which requires every thread pinned at that
+     * time to have unpinned.
+     *
+     * A thread that stays pinned holds back all reclamation, so guards
+     * should be short-lived.
+     */
+    class Epoch {
+
+        public:
+            /**
+             * @brief Keeps the calling thread pinned. Guards nest; the
+             * thread unpins when the outermost one is dropped. A Guard
+             * belongs to the thread that created it.
+             */
+            class Guard {
+
+                public:
+                    ~Guard() noexcept;
+
+                    Guard(const Guard&) = delete;
+                    auto operator=(const Guard&) -> Guard& = delete;
+
+                    /**
+                     * @brief Destroys ptr with Deleter once no thread pinned
+                     * now can still see it. ptr must already be unreachable
+                     * for threads that pin later.
+                     */
+                    template <class T, class Deleter = DefaultDeleter<T>>
+                    auto retire(T* ptr) const noexcept -> void {
+                        this->defer(ptr, [](void* p) noexcept {
+                            Deleter{}(static_cast<T*>(p));
+                        });
+                    }
+
+                    /// Tries to advance the epoch and reclaim now.
+                    auto flush() const noexcept -> void;
+
+                private:
+                    friend class Epoch;
+
+                    explicit Guard(impl::EpochRecord& record) noexcept
+                        : _record(record) {
+                    }
+
+                    auto defer(void* ptr,
+                               auto (*drop)(void*) noexcept -> void) const
+                        noexcept -> void;
+
+                private:
+                    impl::EpochRecord& _record;
+            };
+
+            Epoch() = delete;
+
+            [[nodiscard]] static auto pin() noexcept -> Guard;
+
+            /// Reclaims what is safe, pinned or not.
+            static auto collect() noexcept -> void;
+
+            /**
+             * @brief Moves the epoch on as far as pinned threads allow and
+             * reclaims what that frees, including the lists of exited
+             * threads. With no thread pinned, everything retired so far is
+             * destroyed. The same runs once more at program exit.
+             */
+            static auto flush() noexcept -> void;
+
+            /// Objects retired by this thread that are not yet destroyed.
+            [[nodiscard]] static auto pending() noexcept -> usize;
+    };
+
+}; // namespace lx::core
+
+/// A Guard pins the thread that made it
+template <> struct lx::trait::UnsafeSendMarker<lx::core::Epoch::Guard> {
+        static constexpr auto value = false;
+};
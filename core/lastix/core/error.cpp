@@ -1,26 +1,204 @@
 #include "lastix/core/error.hpp"
+#include "lastix/core/arena.hpp"
+
+#include <cstring>
+#include <new>
 
 namespace lx::core {
 
     namespace impl {
 
-        StringError::StringError(std::string err) : _err(std::move(err)) {
+        StringError::StringError(std::string err) noexcept
+            : _err(std::move(err)) {
         }
 
         auto StringError::what() const noexcept -> std::string_view {
             return _err;
         }
 
+        LiteralError::LiteralError(StaticStr msg) noexcept : _msg(msg) {
+        }
+
+        auto LiteralError::what() const noexcept -> std::string_view {
+            return _msg.view();
+        }
+
     }; // namespace impl
 
-    auto Error::context(std::string_view msg) noexcept -> Error {
-        auto err = Error(std::string(msg));
-        err._next = Some(Box<Error>(std::move(*this)));
-        return err;
+    namespace {
+
+        thread_local ErrorArena* current_arena = nullptr;
+
+        /// Frames a context starts with; enough for most chains.
+        constexpr auto initial_frames = usize{4};
+
+        auto context_bytes(usize capacity) noexcept -> usize {
+            return sizeof(impl::ErrorContext) +
+                   capacity * sizeof(impl::ContextFrame);
+        }
+
+        auto allocate_context(ErrorArena* arena, usize capacity) noexcept
+            -> impl::ErrorContext* {
+
+            auto bytes = context_bytes(capacity);
+            auto* memory = arena != nullptr
+                               ? arena->allocate(bytes,
+                                                 alignof(impl::ErrorContext))
+                               : ::operator new(bytes);
+
+            return new (memory) impl::ErrorContext{arena, 0, capacity};
+        }
+
+        auto free_context(impl::ErrorContext* context) noexcept -> void {
+
+            // Arena memory is released with the arena
+            if (context->arena != nullptr) return;
+
+            for (auto i = usize{0}; i < context->count; i++) {
+                auto& frame = context->frames()[i];
+                if (frame.owned) delete[] frame.data;
+            }
+
+            ::operator delete(context);
+        }
+
+    }; // namespace
+
+    ErrorArena::Scope::Scope(ErrorArena& arena) noexcept
+        : _previous(std::exchange(current_arena, &arena)) {
+    }
+
+    ErrorArena::Scope::~Scope() noexcept {
+        current_arena = _previous;
+    }
+
+    ErrorArena::ErrorArena(usize chunk_size) noexcept : _arena(chunk_size) {
+    }
+
+    ErrorArena::~ErrorArena() noexcept {
+
+        if (_users != 0) [[unlikely]]
+            panic("ErrorArena destroyed while an Error still uses it");
+    }
+
+    auto ErrorArena::reset() noexcept -> void {
+
+        if (_users != 0) [[unlikely]]
+            panic("ErrorArena reset while an Error still uses it");
+
+        _arena.reset();
+    }
+
+    auto ErrorArena::current() noexcept -> ErrorArena* {
+        return current_arena;
+    }
+
+    Error::Error(StaticStr msg) noexcept
+        : Error(std::in_place, impl::LiteralError(msg)) {
+    }
+
+    Error::Error(Error&& other) noexcept
+        : _vtable(std::exchange(other._vtable, nullptr)),
+          _context(std::exchange(other._context, nullptr)) {
+
+        if (_vtable != nullptr) _vtable->move(_storage, other._storage);
+    }
+
+    auto Error::operator=(Error&& other) noexcept -> Error& {
+
+        if (this != &other) [[likely]] {
+            std::destroy_at(this);
+            std::construct_at(this, std::move(other));
+        }
+
+        return *this;
+    }
+
+    Error::~Error() noexcept {
+        this->release_context();
+        if (_vtable != nullptr) _vtable->destroy(_storage);
+    }
+
+    auto Error::context(StaticStr msg) noexcept -> Error {
+        this->push_context(msg.view(), false);
+        return std::move(*this);
     }
 
     auto Error::what() const noexcept -> std::string_view {
-        return _inner->what();
+
+        if (_context != nullptr && _context->count != 0)
+            return _context->frames()[_context->count - 1].view();
+
+        return this->root_what();
+    }
+
+    auto Error::root_what() const noexcept -> std::string_view {
+
+        if (_vtable == nullptr) [[unlikely]]
+            panic("Dereferencing nullptr");
+
+        return _vtable->what(_vtable->payload(_storage));
+    }
+
+    auto Error::push_context(std::string_view msg, bool copy) noexcept
+        -> void {
+
+        if (!copy) {
+            this->next_frame() =
+                impl::ContextFrame{msg.data(), msg.size(), false};
+            return;
+        }
+
+        std::memcpy(this->push_context_buffer(msg.size()), msg.data(),
+                    msg.size());
+    }
+
+    auto Error::push_context_buffer(usize size) noexcept -> char* {
+
+        auto& frame = this->next_frame();
+        auto* arena = _context->arena;
+
+        auto* data = arena != nullptr
+                         ? static_cast<char*>(arena->allocate(size, 1))
+                         : new char[size];
+
+        frame = impl::ContextFrame{data, size, arena == nullptr};
+        return data;
+    }
+
+    auto Error::next_frame() noexcept -> impl::ContextFrame& {
+
+        if (_context == nullptr) {
+            auto* arena = ErrorArena::current();
+            if (arena != nullptr) arena->_users += 1;
+
+            _context = allocate_context(arena, initial_frames);
+        }
+
+        auto* arena = _context->arena;
+
+        if (_context->count == _context->capacity) [[unlikely]] {
+            auto* grown = allocate_context(arena, _context->capacity * 2);
+
+            std::memcpy(grown->frames(), _context->frames(),
+                        _context->count * sizeof(impl::ContextFrame));
+            grown->count = _context->count;
+
+            // The frames moved, so the old block must not free their copies
+            _context->count = 0;
+            free_context(std::exchange(_context, grown));
+        }
+
+        return _context->frames()[_context->count++];
+    }
+
+    auto Error::release_context() noexcept -> void {
+
+        if (_context == nullptr) return;
+
+        if (_context->arena != nullptr) _context->arena->_users -= 1;
+
+        free_context(std::exchange(_context, nullptr));
     }
 
 }; // namespace lx::core
@@ -1,69 +1,339 @@
 #pragma once
 
 #include "lastix/core/option.hpp"
-#include "lastix/core/box.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/static_str.hpp"
+#include "lastix/trait/error.hpp"
+#include "lastix/trait/niche.hpp"
 
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <memory>
 #include <string_view>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 namespace lx::core {
 
+    /// Defined in lastix/core/arena.hpp, on top of Arena.
+    class ErrorArena;
+
     namespace impl {
 
-        struct ErrorBase {
-                virtual ~ErrorBase() noexcept = default;
-                virtual auto what() const noexcept -> std::string_view = 0;
+        /// Payload of Error(std::string).
+        class StringError {
+
+            public:
+                StringError(std::string err) noexcept;
+
+                auto what() const noexcept -> std::string_view;
+
+            protected:
+                std::string _err;
         };
 
-        class StringError : public ErrorBase {
+        /// Payload of Error("literal").
+        class LiteralError {
 
             public:
-                StringError(std::string err);
+                LiteralError(StaticStr msg) noexcept;
 
-                auto what() const noexcept -> std::string_view override;
+                auto what() const noexcept -> std::string_view;
 
             protected:
-                std::string _err;
+                StaticStr _msg;
+        };
+
+        /// Formatted context that context_fmt() builds on the stack.
+        inline constexpr auto context_fmt_inline = usize{128};
+
+        /// Bytes a payload may take to be stored inside the Error.
+        inline constexpr auto error_inline_size = usize{32};
+        inline constexpr auto error_inline_align = alignof(void*);
+
+        template <class E>
+        inline constexpr auto error_inline =
+            sizeof(E) <= error_inline_size &&
+            alignof(E) <= error_inline_align &&
+            std::is_nothrow_move_constructible_v<E>;
+
+        /// Its address identifies E in Error::downcast(), without RTTI.
+        template <class E> inline constexpr char error_type_tag = 0;
+
+        /**
+         * @brief Hand-written vtable of an Error payload. `storage` is the
+         * Error's inline buffer, holding either the payload or a pointer to
+         * it on the heap.
+         */
+        struct ErrorVTable {
+                auto (*payload)(const std::byte* storage) noexcept
+                    -> const void*;
+                auto (*what)(const void* payload) noexcept
+                    -> std::string_view;
+                auto (*move)(std::byte* to, std::byte* from) noexcept -> void;
+                auto (*destroy)(std::byte* storage) noexcept -> void;
+                const char* type;
+        };
+
+        template <class E> struct ErrorVTableFor {
+
+                static auto payload(const std::byte* storage) noexcept
+                    -> const void* {
+
+                    if constexpr (error_inline<E>)
+                        return storage;
+                    else
+                        return *std::launder(
+                            reinterpret_cast<const E* const*>(storage));
+                }
+
+                static auto what(const void* payload) noexcept
+                    -> std::string_view {
+                    return lx::trait::ErrorImpl<E>::what(
+                        *static_cast<const E*>(payload));
+                }
+
+                static auto move(std::byte* to, std::byte* from) noexcept
+                    -> void {
+
+                    if constexpr (error_inline<E>) {
+                        auto* source = std::launder(reinterpret_cast<E*>(from));
+                        std::construct_at(reinterpret_cast<E*>(to),
+                                          std::move(*source));
+                        std::destroy_at(source);
+                    } else {
+                        std::memcpy(to, from, sizeof(E*));
+                    }
+                }
+
+                static auto destroy(std::byte* storage) noexcept -> void {
+
+                    if constexpr (error_inline<E>)
+                        std::destroy_at(
+                            std::launder(reinterpret_cast<E*>(storage)));
+                    else
+                        delete *std::launder(reinterpret_cast<E**>(storage));
+                }
+
+                static constexpr auto vtable = ErrorVTable{
+                    payload, what, move, destroy, &error_type_tag<E>};
+        };
+
+        /// One context message of an Error.
+        struct ContextFrame {
+                const char* data;
+                usize size;
+
+                /// Heap copy that the frame frees; never set in an arena.
+                bool owned;
+
+                [[nodiscard]] auto view() const noexcept -> std::string_view {
+                    return {data, size};
+                }
+        };
+
+        /**
+         * @brief Context messages of an Error, oldest first, followed in
+         * memory by `capacity` frames. Lives in an ErrorArena or on the heap.
+         */
+        struct ErrorContext {
+                ErrorArena* arena;
+                usize count;
+                usize capacity;
+
+                [[nodiscard]] auto frames() noexcept -> ContextFrame* {
+                    return reinterpret_cast<ContextFrame*>(this + 1);
+                }
+
+                [[nodiscard]] auto frames() const noexcept
+                    -> const ContextFrame* {
+                    return reinterpret_cast<const ContextFrame*>(this + 1);
+                }
         };
 
     }; // namespace impl
 
+    /**
+     * @brief Type-erased error with a chain of context messages.
+     *
+     * The payload is a string or any lx::trait::ErrorPayload type. Payloads
+     * of up to impl::error_inline_size bytes are stored inside the Error and
+     * dispatched through a static vtable, larger ones are boxed.
+     *
+     * That makes an Error six words on 64-bit targets (vtable, 32-byte
+     * buffer, context). A Result<T, Error> is no larger as long as T fits
+     * behind the vtable pointer. The buffer is sized for a std::string, so
+     * string errors with short messages do not allocate.
+     */
     class Error {
 
         public:
-            // template <class E>
-            // Error(E e) noexcept : _inner(Box<E>(std::move(e))) {
-            // }
+            /// Borrows a string literal: creating the Error does not allocate.
+            Error(StaticStr msg) noexcept;
+
+            template <class T>
+            requires std::convertible_to<T, std::string> &&
+                     (!impl::StringLiteral<T>)
+            Error(T&& e) noexcept
+                : Error(std::in_place,
+                        impl::StringError(std::string(std::forward<T>(e)))) {
+            }
+
+            /// Stores a typed payload that downcast<E>() gives back.
+            template <class E>
+            requires lx::trait::ErrorPayload<std::remove_cvref_t<E>> &&
+                     (!std::convertible_to<E, std::string>) &&
+                     (!std::same_as<std::remove_cvref_t<E>, Error>)
+            Error(E&& payload) noexcept
+                : Error(std::in_place, std::forward<E>(payload)) {
+            }
+
+            Error(Error&& other) noexcept;
+            auto operator=(Error&& other) noexcept -> Error&;
+            ~Error() noexcept;
+
+            /**
+             * @brief Adds a literal message on top of this error and returns
+             * it. The literal is borrowed, only the frame is stored.
+             */
+            auto context(StaticStr msg) noexcept -> Error;
 
+            /**
+             * @brief Adds a copy of msg on top of this error and returns it.
+             *
+             * Frames and copies go to the current ErrorArena if there is
+             * one, otherwise to the heap.
+             */
             template <class T>
-            requires std::convertible_to<T, std::string>
-            Error(T e) noexcept : _inner(Box<impl::StringError>(std::move(e))) {
+            requires std::convertible_to<T, std::string_view> &&
+                     (!impl::StringLiteral<T>)
+            auto context(T&& msg) noexcept -> Error {
+                this->push_context(std::string_view(msg), true);
+                return std::move(*this);
             }
 
-            auto context(std::string_view msg) noexcept -> Error;
+            /**
+             * @brief Adds std::format(fmt, args...) on top of this error and
+             * returns it, without a temporary std::string.
+             *
+             * The text is formatted once into a stack buffer and copied to
+             * the frame. Only a message longer than the buffer is formatted
+             * again, straight into a frame of the size the first pass
+             * reported.
+             */
+            template <class... Args>
+            auto context_fmt(std::format_string<Args...> fmt,
+                             Args&&... args) noexcept -> Error {
+
+                char text[impl::context_fmt_inline];
+                auto size = static_cast<usize>(
+                    std::format_to_n(text, std::ssize(text), fmt,
+                                     std::forward<Args>(args)...)
+                        .size);
+
+                if (size <= std::size(text)) [[likely]]
+                    this->push_context(std::string_view(text, size), true);
+                else
+                    std::format_to(this->push_context_buffer(size), fmt,
+                                   std::forward<Args>(args)...);
 
+                return std::move(*this);
+            }
+
+            /// The outermost message: the last context, or the error itself.
             auto what() const noexcept -> std::string_view;
 
+            /// Calls f with every message, outermost first.
             template <class F>
             requires std::is_invocable_v<F, std::string_view>
             auto write(F&& f) const
                 noexcept(std::is_nothrow_invocable_v<F, std::string_view>)
                     -> void {
 
-                f(_inner->what());
-                const auto* next = &_next;
+                if (_context != nullptr) {
+                    const auto* frames = _context->frames();
+
+                    for (auto i = _context->count; i > 0; i--)
+                        f(frames[i - 1].view());
+                }
+
+                f(this->root_what());
+            }
+
+            /// The payload, if it is an E.
+            template <class E>
+            [[nodiscard]] auto downcast() const noexcept -> Option<const E&> {
+
+                if (!this->is<E>()) return None;
+
+                return Some<const E&>(*static_cast<const E*>(
+                    _vtable->payload(_storage)));
+            }
+
+            template <class E>
+            [[nodiscard]] auto downcast() noexcept -> Option<E&> {
+
+                if (!this->is<E>()) return None;
+
+                return Some<E&>(*const_cast<E*>(
+                    static_cast<const E*>(_vtable->payload(_storage))));
+            }
+
+            template <class E> [[nodiscard]] auto is() const noexcept -> bool {
+                return _vtable != nullptr &&
+                       _vtable->type == &impl::error_type_tag<E>;
+            }
+
+            Error(const Error&) = delete;
+            auto operator=(const Error&) -> Error& = delete;
+
+        protected:
+            template <class E, class Payload = std::remove_cvref_t<E>>
+            Error(std::in_place_t, E&& payload) noexcept
+                : _vtable(&impl::ErrorVTableFor<Payload>::vtable) {
 
-                while (next->is_some()) {
-                    f(next->unwrap()->what());
-                    next = (&next->unwrap()->_next);
+                if constexpr (impl::error_inline<Payload>) {
+                    std::construct_at(reinterpret_cast<Payload*>(_storage),
+                                      std::forward<E>(payload));
+                } else {
+                    auto* boxed = new Payload(std::forward<E>(payload));
+                    std::memcpy(_storage, &boxed, sizeof(boxed));
                 }
             }
 
+            /// Message of the error itself, below all context frames.
+            auto root_what() const noexcept -> std::string_view;
+
+            /// Appends a frame, copying msg first if `copy` is set.
+            auto push_context(std::string_view msg, bool copy) noexcept
+                -> void;
+
+            /// Appends a frame of `size` chars for the caller to fill in.
+            auto push_context_buffer(usize size) noexcept -> char*;
+
+            /// Adds an empty frame slot, growing the frame array if needed.
+            auto next_frame() noexcept -> impl::ContextFrame&;
+
+            auto release_context() noexcept -> void;
+
         protected:
-            Box<impl::ErrorBase> _inner;
-            Option<Box<Error>> _next = None;
-    };
+            /// Null only in a moved-from Error.
+            const impl::ErrorVTable* _vtable;
+
+            alignas(impl::error_inline_align)
+                std::byte _storage[impl::error_inline_size];
 
+            impl::ErrorContext* _context = nullptr;
+    };
 
 }; // namespace lx::core
+
+/// An Error starts with its vtable pointer, which is never 1
+template <> struct lx::trait::UnsafeNicheMarker<lx::core::Error> {
+        static constexpr auto value = true;
+        static constexpr auto offset = std::size_t{0};
+        static constexpr auto none = lx::trait::pointer_niche;
+};
@@ -0,0 +1,324 @@
+#pragma once
+
+#include "lastix/core/diagnostics.hpp"
+#include "lastix/core/memory.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/trait/intrusive.hpp"
+#include "lastix/trait/niche.hpp"
+#include "lastix/trait/send.hpp"
+#include "lastix/trait/sync.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace lx::core {
+
+    /**
+     * @brief Thread-safe reference count to embed in a type shared through
+     * IntrusiveArc. Uses the same orderings as Arc: relaxed increments,
+     * release decrements and an acquire fence before the last drop.
+     *
+     * Copying the host object does not copy its count.
+     */
+    class AtomicRefCount {
+
+        public:
+            static constexpr auto atomic = true;
+
+            AtomicRefCount() noexcept = default;
+
+            AtomicRefCount(const AtomicRefCount&) noexcept {
+            }
+
+            auto operator=(const AtomicRefCount&) noexcept
+                -> AtomicRefCount& {
+                return *this;
+            }
+
+            auto retain() const noexcept -> void {
+                if (_count.fetch_add(1, std::memory_order_relaxed) >
+                    max_count) [[unlikely]]
+                    panic("IntrusiveArc reference count overflow");
+            }
+
+            [[nodiscard]] auto release() const noexcept -> bool {
+                if (_count.fetch_sub(1, std::memory_order_release) != 1)
+                    return false;
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return true;
+            }
+
+            [[nodiscard]] auto count() const noexcept -> usize {
+                return _count.load(std::memory_order_acquire);
+            }
+
+            [[nodiscard]] auto ref_count() const noexcept
+                -> const AtomicRefCount& {
+                return *this;
+            }
+
+        private:
+            static constexpr auto max_count =
+                std::numeric_limits<usize>::max() / 2;
+
+            mutable std::atomic<usize> _count = 0;
+    };
+
+    /// Single-threaded count; IntrusiveArcs to such a type are not Send.
+    class LocalRefCount {
+
+        public:
+            static constexpr auto atomic = false;
+
+            LocalRefCount() noexcept = default;
+
+            LocalRefCount(const LocalRefCount&) noexcept {
+            }
+
+            auto operator=(const LocalRefCount&) noexcept -> LocalRefCount& {
+                return *this;
+            }
+
+            auto retain() const noexcept -> void {
+                if (_count++ == std::numeric_limits<usize>::max()) [[unlikely]]
+                    panic("IntrusiveArc reference count overflow");
+            }
+
+            [[nodiscard]] auto release() const noexcept -> bool {
+                return --_count == 0;
+            }
+
+            [[nodiscard]] auto count() const noexcept -> usize {
+                return _count;
+            }
+
+            [[nodiscard]] auto ref_count() const noexcept
+                -> const LocalRefCount& {
+                return *this;
+            }
+
+        private:
+            mutable usize _count = 0;
+    };
+
+    namespace impl {
+
+        /// Del frees a U the way Deleter frees a T.
+        template <class U, class Del, class T, class Deleter>
+        concept ReleasesLike = std::same_as<Del, Deleter> ||
+                               (std::same_as<Del, DefaultDeleter<U>> &&
+                                std::same_as<Deleter, DefaultDeleter<T>>);
+
+    }; // namespace impl
+
+    /**
+     * @brief Shared pointer to a T that carries its own reference count, as
+     * located by lx::trait::IntrusiveImpl.
+     *
+     * The handle is one pointer and there is no control block, so any T*
+     * to a live object, including `this`, can be turned back into a handle
+     * with from_raw(). There are no weak references. The last handle frees
+     * the object through Deleter, which for a handle to a base class needs
+     * a virtual destructor, as with Box.
+     *
+     * T may be incomplete where the handle is declared, so nodes can hold
+     * handles to their own type.
+     */
+    template <class T, class Deleter = DefaultDeleter<T>> class IntrusiveArc {
+
+        public:
+            template <class... Args>
+            requires std::constructible_from<T, Args...>
+            explicit IntrusiveArc(Args&&... args) noexcept
+                : _ptr(new T(std::forward<Args>(args)...)) {
+                counter(_ptr).retain();
+            }
+
+            IntrusiveArc(IntrusiveArc&& other) noexcept
+                : _ptr(std::exchange(other._ptr, nullptr)) {
+            }
+
+            IntrusiveArc(const IntrusiveArc& other) noexcept
+                : _ptr(other._ptr) {
+                if (_ptr != nullptr) counter(_ptr).retain();
+            }
+
+            /**
+             * @brief Handles to a derived object convert when they free it
+             * the same way: with the same deleter, or both with delete.
+             */
+            template <class U, class Del>
+            requires std::derived_from<U, T> &&
+                     impl::ReleasesLike<U, Del, T, Deleter>
+            IntrusiveArc(IntrusiveArc<U, Del>&& other) noexcept
+                : _ptr(std::exchange(other._ptr, nullptr)) {
+            }
+
+            template <class U, class Del>
+            requires std::derived_from<U, T> &&
+                     impl::ReleasesLike<U, Del, T, Deleter>
+            IntrusiveArc(const IntrusiveArc<U, Del>& other) noexcept
+                : _ptr(other._ptr) {
+                if (_ptr != nullptr) counter(_ptr).retain();
+            }
+
+            auto operator=(IntrusiveArc&& other) noexcept -> IntrusiveArc& {
+                if (this != &other) {
+                    this->reset();
+                    _ptr = std::exchange(other._ptr, nullptr);
+                }
+
+                return *this;
+            }
+
+            auto operator=(const IntrusiveArc& other) noexcept
+                -> IntrusiveArc& {
+                if (other._ptr != nullptr) counter(other._ptr).retain();
+
+                this->reset();
+                _ptr = other._ptr;
+
+                return *this;
+            }
+
+            ~IntrusiveArc() noexcept {
+                this->reset();
+            }
+
+            /**
+             * @brief A new handle to an object that is already shared, for
+             * example `from_raw(this)` inside a member function.
+             */
+            [[nodiscard]] static auto from_raw(T* ptr) noexcept
+                -> IntrusiveArc {
+
+                if (ptr == nullptr) [[unlikely]]
+                    panic("IntrusiveArc::from_raw called with nullptr");
+
+                counter(ptr).retain();
+                return IntrusiveArc(adopt, ptr);
+            }
+
+            auto reset() noexcept -> void {
+
+                auto* ptr = std::exchange(_ptr, nullptr);
+                if (ptr != nullptr && counter(ptr).release()) Deleter{}(ptr);
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> const T* {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return _ptr;
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> const T& {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return *_ptr;
+            }
+
+            template <class V = void>
+            requires(lx::trait::Sync<T>)
+            [[nodiscard]] auto operator->() noexcept -> T* {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return _ptr;
+            }
+
+            template <class V = void>
+            requires(lx::trait::Sync<T>)
+            [[nodiscard]] auto operator*() noexcept -> T& {
+
+                if (_ptr == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return *_ptr;
+            }
+
+            /// The object, if this is the only handle to it.
+            [[nodiscard]] auto get_mut() noexcept -> Option<T&> {
+
+                if (_ptr == nullptr || counter(_ptr).count() != 1)
+                    return None;
+
+                return Some<T&>(*_ptr);
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return _ptr != nullptr;
+            }
+
+            auto swap(IntrusiveArc& other) noexcept -> void {
+                std::swap(_ptr, other._ptr);
+            }
+
+            auto unsafe_get() const& noexcept -> const T* {
+                return _ptr;
+            }
+
+            [[nodiscard]] auto strong_count() const noexcept -> Option<usize> {
+                if (_ptr == nullptr) [[unlikely]]
+                    return None;
+
+                return Some(counter(_ptr).count());
+            }
+
+            [[nodiscard]] static auto ptr_eq(const IntrusiveArc& a,
+                                             const IntrusiveArc& b) noexcept
+                -> bool {
+                return a._ptr == b._ptr;
+            }
+
+        private:
+            struct Adopt {};
+            static constexpr auto adopt = Adopt{};
+
+            IntrusiveArc(Adopt, T* ptr) noexcept : _ptr(ptr) {
+            }
+
+            static auto counter(const T* ptr) noexcept -> decltype(auto) {
+                static_assert(lx::trait::Intrusive<std::remove_const_t<T>>,
+                              "T has no reference count IntrusiveArc can find");
+
+                return lx::trait::IntrusiveImpl<std::remove_const_t<T>>::
+                    counter(*ptr);
+            }
+
+            template <class U, class Del> friend class IntrusiveArc;
+
+        private:
+            T* _ptr = nullptr;
+    };
+
+}; // namespace lx::core
+
+/// Only handles to atomically counted objects may cross threads
+template <class T, class Deleter>
+struct lx::trait::UnsafeSendMarker<lx::core::IntrusiveArc<T, Deleter>> {
+        static constexpr auto value =
+            lx::trait::Send<T> &&
+            std::remove_cvref_t<decltype(lx::trait::IntrusiveImpl<
+                                         std::remove_const_t<T>>::
+                                             counter(std::declval<
+                                                     const T&>()))>::atomic;
+};
+
+/// An IntrusiveArc never points at address 1, even when empty or moved from
+template <class T, class Deleter>
+struct lx::trait::UnsafeNicheMarker<lx::core::IntrusiveArc<T, Deleter>> {
+        static constexpr auto value = true;
+        static constexpr auto offset = std::size_t{0};
+        static constexpr auto none = lx::trait::pointer_niche;
+};
@@ -1,5 +1,12 @@
 #pragma once
 
+#include "lastix/core/number.hpp"
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+
 namespace lx::core {
 
     template <class T> struct DefaultDeleter {
@@ -8,10 +15,141 @@ namespace lx::core {
             }
     };
 
+    /**
+     * @brief delete[] for arrays from new T[]. Box<T[]> passes the length
+     * instead: its elements are built in place in storage from
+     * std::allocator<T>, so they are destroyed one by one and the storage
+     * is given back.
+     */
     template <class T> struct DefaultDeleter<T[]> {
             auto operator()(T *ptr) const noexcept -> void {
                 delete[] ptr;
             }
+
+            auto operator()(T *ptr, std::size_t len) const noexcept -> void {
+
+                if (ptr == nullptr) return;
+
+                std::destroy_n(ptr, len);
+                std::allocator<T>().deallocate(ptr, len);
+            }
+    };
+
+    /**
+     * @brief Deleter of a Box made by Box::new_in(): destroys the value and
+     * hands its memory back to the allocator it came from.
+     *
+     * Alloc is any standard allocator, static (stateless) or polymorphic
+     * like std::pmr::polymorphic_allocator. A stateless one takes no space.
+     */
+    template <class T, class Alloc> struct AllocatorDeleter {
+
+            using Allocator = typename std::allocator_traits<
+                Alloc>::template rebind_alloc<T>;
+
+            auto operator()(T *ptr) noexcept -> void {
+
+                if (ptr == nullptr) return;
+
+                std::destroy_at(ptr);
+                std::allocator_traits<Allocator>::deallocate(alloc, ptr, 1);
+            }
+
+            [[no_unique_address]] Allocator alloc;
+    };
+
+    /**
+     * @brief Deleter of a Box<T[]> made by Vec::into_boxed_slice(): destroys
+     * the `len` elements and gives the block of `capacity` back to the
+     * allocator.
+     */
+    template <class T, class Alloc> struct AllocatorSliceDeleter {
+
+            using Allocator = typename std::allocator_traits<
+                Alloc>::template rebind_alloc<T>;
+
+            auto operator()(T *ptr) noexcept -> void {
+
+                if (ptr == nullptr) return;
+
+                std::destroy_n(ptr, len);
+                std::allocator_traits<Allocator>::deallocate(alloc, ptr,
+                                                             capacity);
+            }
+
+            [[no_unique_address]] Allocator alloc;
+            usize len = 0;
+            usize capacity = 0;
+    };
+
+    /**
+     * @brief malloc/free allocator that reports failure with nullptr instead
+     * of throwing, which is what lets Vec::try_reserve() recover from running
+     * out of memory. Also offers reallocate() for realloc-based growth.
+     *
+     * Returning nullptr breaks the std::allocator requirements, so std
+     * containers must not use it.
+     */
+    template <class T> class SystemAllocator {
+
+        public:
+            using value_type = T;
+
+            SystemAllocator() noexcept = default;
+
+            template <class U>
+            SystemAllocator(const SystemAllocator<U> &) noexcept {
+            }
+
+            /// n slots of T, or nullptr when out of memory.
+            [[nodiscard]] auto allocate(usize n) noexcept -> T * {
+
+                if (n > std::numeric_limits<usize>::max() / sizeof(T))
+                    [[unlikely]]
+                    return nullptr;
+
+                if constexpr (over_aligned) {
+                    // aligned_alloc wants a multiple of the alignment
+                    auto bytes = (n * sizeof(T) + alignof(T) - 1) &
+                                 ~(alignof(T) - 1);
+                    return static_cast<T *>(
+                        std::aligned_alloc(alignof(T), bytes));
+                } else {
+                    return static_cast<T *>(std::malloc(n * sizeof(T)));
+                }
+            }
+
+            auto deallocate(T *ptr, usize) noexcept -> void {
+                std::free(ptr);
+            }
+
+            /**
+             * @brief Resizes a block from allocate() to n slots, in place
+             * when the heap can. The bytes are copied, so T must be
+             * trivially relocatable. On failure nullptr is returned and the
+             * block is left alone.
+             */
+            [[nodiscard]] auto reallocate(T *ptr, usize, usize n) noexcept
+                -> T *
+            requires(alignof(T) <= alignof(std::max_align_t))
+            {
+                if (n > std::numeric_limits<usize>::max() / sizeof(T))
+                    [[unlikely]]
+                    return nullptr;
+
+                return static_cast<T *>(std::realloc(ptr, n * sizeof(T)));
+            }
+
+            template <class U>
+            auto operator==(const SystemAllocator<U> &) const noexcept
+                -> bool {
+                return true;
+            }
+
+        private:
+            // aligned_alloc() blocks cannot go through realloc()
+            static constexpr auto over_aligned =
+                alignof(T) > alignof(std::max_align_t);
     };
 
 }; // namespace lx::core
@@ -1,8 +1,18 @@
 #pragma once
 
 #include "lastix/core/diagnostics.hpp"
+#include "lastix/trait/niche.hpp"
+#include "lastix/trait/relocatable.hpp"
+#include "lastix/trait/send.hpp"
 
+#include <concepts>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
 #include <optional>
+#include <type_traits>
+#include <utility>
 
 namespace lx::core {
 
@@ -12,7 +22,8 @@ namespace lx::core {
     template <class T> class Some {
 
         public:
-            explicit Some(T value) noexcept : _value(std::move(value)) {
+            constexpr explicit Some(T value) noexcept
+                : _value(std::forward<T>(value)) {
             }
 
             // template <class... Args>
@@ -21,7 +32,8 @@ namespace lx::core {
             // }
 
             template <class Self>
-            auto operator*(this Self&& self) noexcept -> decltype(auto) {
+            constexpr auto operator*(this Self&& self) noexcept
+                -> decltype(auto) {
                 return std::forward_like<Self>(self._value);
             }
 
@@ -31,30 +43,227 @@ namespace lx::core {
 
     template <class U> Some(Some<U> s) -> Some<Some<U>>;
 
+    template <class T> class Option;
+
+    namespace impl {
+
+        template <class T> struct IsOptionHelper : std::false_type {};
+        template <class T> struct IsOptionHelper<Option<T>> : std::true_type {};
+
+        /// T is some Option<U>.
+        template <class T>
+        concept IsOption = IsOptionHelper<std::remove_cvref_t<T>>::value;
+
+        /**
+         * @brief Turns Option<Result<T, E>> into Result<Option<T>, E>.
+         * Specialized in result.hpp, which knows Result.
+         */
+        template <class T> struct OptionTranspose;
+
+        /// Storage for types without a niche: std::optional and its flag.
+        template <class T> class OptionStorage {
+
+            public:
+                constexpr OptionStorage(NoneType) noexcept : _value(None) {
+                }
+
+                template <class U>
+                constexpr OptionStorage(std::in_place_t, U&& value) noexcept
+                    : _value(std::forward<U>(value)) {
+                }
+
+                [[nodiscard]] constexpr auto has_value() const noexcept
+                    -> bool {
+                    return _value.has_value();
+                }
+
+                [[nodiscard]] constexpr auto get() noexcept -> T& {
+                    return *_value;
+                }
+
+                [[nodiscard]] constexpr auto get() const noexcept -> const T& {
+                    return *_value;
+                }
+
+            private:
+                std::optional<T> _value;
+        };
+
+        /**
+         * @brief Storage for types with a niche: None is the niche pattern
+         * written over the bytes where T would live. Not constexpr, as the
+         * niche word is read through memcpy.
+         *
+         * A byte buffer rather than a union, so T's special members are only
+         * looked up when used: Error holds an Option<Box<Error>> while Error
+         * is still incomplete.
+         */
+        template <lx::trait::Niche T> class OptionStorage<T> {
+
+            public:
+                OptionStorage(NoneType) noexcept {
+                    this->set_none();
+                }
+
+                template <class U>
+                OptionStorage(std::in_place_t, U&& value) noexcept {
+                    std::construct_at(this->ptr(), std::forward<U>(value));
+                }
+
+                OptionStorage(const OptionStorage& other) noexcept
+                requires std::is_copy_constructible_v<T>
+                {
+                    if (other.has_value())
+                        std::construct_at(this->ptr(), other.get());
+                    else
+                        this->set_none();
+                }
+
+                OptionStorage(OptionStorage&& other) noexcept {
+                    if (other.has_value())
+                        std::construct_at(this->ptr(), std::move(other.get()));
+                    else
+                        this->set_none();
+                }
+
+                ~OptionStorage() noexcept {
+                    this->reset();
+                }
+
+                auto operator=(const OptionStorage& other) noexcept
+                    -> OptionStorage&
+                requires std::is_copy_constructible_v<T>
+                {
+                    if (this != &other) [[likely]] {
+                        this->reset();
+                        if (other.has_value())
+                            std::construct_at(this->ptr(), other.get());
+                    }
+
+                    return *this;
+                }
+
+                auto operator=(OptionStorage&& other) noexcept
+                    -> OptionStorage& {
+
+                    if (this != &other) [[likely]] {
+                        this->reset();
+                        if (other.has_value())
+                            std::construct_at(this->ptr(),
+                                              std::move(other.get()));
+                    }
+
+                    return *this;
+                }
+
+                [[nodiscard]] auto has_value() const noexcept -> bool {
+
+                    auto word = std::uintptr_t{};
+                    std::memcpy(&word, _bytes + Niche::offset, sizeof(word));
+
+                    return word != Niche::none;
+                }
+
+                [[nodiscard]] auto get() noexcept -> T& {
+                    return *std::launder(this->ptr());
+                }
+
+                [[nodiscard]] auto get() const noexcept -> const T& {
+                    return *std::launder(reinterpret_cast<const T*>(_bytes));
+                }
+
+            private:
+                using Niche = lx::trait::UnsafeNicheMarker<T>;
+
+                auto ptr() noexcept -> T* {
+                    return reinterpret_cast<T*>(_bytes);
+                }
+
+                auto set_none() noexcept -> void {
+                    std::memcpy(_bytes + Niche::offset, &Niche::none,
+                                sizeof(Niche::none));
+                }
+
+                auto reset() noexcept -> void {
+                    if (this->has_value()) {
+                        std::destroy_at(&this->get());
+                        this->set_none();
+                    }
+                }
+
+            private:
+                alignas(T) std::byte _bytes[sizeof(T)];
+        };
+
+        /// Storage for references: a pointer that is null for None.
+        template <class T> class OptionStorage<T&> {
+
+            public:
+                constexpr OptionStorage(NoneType) noexcept {
+                }
+
+                template <class U>
+                constexpr OptionStorage(std::in_place_t, U&& value) noexcept
+                    : _ptr(std::addressof(value)) {
+                }
+
+                [[nodiscard]] constexpr auto has_value() const noexcept
+                    -> bool {
+                    return _ptr != nullptr;
+                }
+
+                [[nodiscard]] constexpr auto get() const noexcept -> T& {
+                    return *_ptr;
+                }
+
+            private:
+                T* _ptr = nullptr;
+        };
+
+    }; // namespace impl
+
+    /**
+     * @brief Optional value. Types that declare a lx::trait::Niche (Box, Arc,
+     * Rc) and references need no engaged flag, so for them Option<T> is as
+     * big as T and is_some() is a single compare.
+     *
+     * Everything is constexpr. Only options of niche types, which read the
+     * niche word through memcpy, are limited to run time.
+     */
     template <class T> class [[nodiscard]] Option {
 
         public:
-            Option(NoneType) : _value(None) {
+            using Value = T;
+
+            /// T as forwarded out of a Self of that value category.
+            template <class Self>
+            using Payload = std::conditional_t<
+                std::is_reference_v<T>, T,
+                decltype(std::forward_like<Self>(std::declval<T&>()))>;
+
+            constexpr Option(NoneType) : _value(None) {
             }
 
-            Option(Some<T> some) : _value(*std::move(some)) {
+            constexpr Option(Some<T> some)
+                : _value(std::in_place, *std::move(some)) {
             }
 
             template <class U>
             requires std::convertible_to<U, T>
-            Option(Some<U> some) : _value(*std::move(some)) {
+            constexpr Option(Some<U> some)
+                : _value(std::in_place, *std::move(some)) {
             }
 
-            [[nodiscard]] auto is_some() const noexcept -> bool {
+            [[nodiscard]] constexpr auto is_some() const noexcept -> bool {
                 return _value.has_value();
             }
 
-            [[nodiscard]] auto is_none() const noexcept -> bool {
+            [[nodiscard]] constexpr auto is_none() const noexcept -> bool {
                 return !this->is_some();
             }
 
             template <class Self>
-            auto unwrap(this Self&& self,
+            constexpr auto unwrap(this Self&& self,
                         std::source_location loc =
                             std::source_location::current()) noexcept
                 -> decltype(auto) {
@@ -63,34 +272,193 @@ namespace lx::core {
             }
 
             template <class Self>
-            auto expect(this Self&& self, std::string_view msg,
+            constexpr auto expect(this Self&& self, std::string_view msg,
                         std::source_location loc =
                             std::source_location::current()) noexcept
                 -> decltype(auto) {
-                if (!self._value) [[unlikely]]
+                if (!self._value.has_value()) [[unlikely]]
                     panic(msg, loc);
 
-                return std::forward_like<Self>(*self._value);
+                return std::forward<Self>(self).payload();
+            }
+
+            /// Unwraps the value without checking that there is one.
+            template <class Self>
+            constexpr auto unsafe_unwrap(this Self&& self) noexcept
+                -> decltype(auto) {
+                return std::forward<Self>(self).payload();
+            }
+
+            /// Returns the value, or `fallback` when there is none.
+            template <class Self>
+            constexpr auto unwrap_or(this Self&& self, T fallback) noexcept
+                -> T {
+
+                if (self.is_some()) return std::forward<Self>(self).payload();
+
+                return std::forward<T>(fallback);
+            }
+
+            /// Returns the value, or what `f()` returns when there is none.
+            template <class Self, class F>
+            constexpr auto unwrap_or_else(this Self&& self, F&& f) noexcept(
+                std::is_nothrow_invocable_v<F>) -> T {
+
+                if (self.is_some()) return std::forward<Self>(self).payload();
+
+                return std::invoke(std::forward<F>(f));
+            }
+
+            /// Some(f(value)), or None. The value is forwarded, not copied.
+            template <class Self, class F>
+            constexpr auto map(this Self&& self, F&& f) noexcept(
+                std::is_nothrow_invocable_v<F, Payload<Self>>)
+                -> Option<std::invoke_result_t<F, Payload<Self>>> {
+
+                using U = std::invoke_result_t<F, Payload<Self>>;
+
+                if (self.is_none()) return None;
+
+                return Some<U>(std::invoke(std::forward<F>(f),
+                                           std::forward<Self>(self).payload()));
+            }
+
+            /// f(value), which returns an Option itself, or None.
+            template <class Self, class F>
+            requires impl::IsOption<std::invoke_result_t<F, Payload<Self>>>
+            constexpr auto and_then(this Self&& self, F&& f) noexcept(
+                std::is_nothrow_invocable_v<F, Payload<Self>>)
+                -> std::invoke_result_t<F, Payload<Self>> {
+
+                if (self.is_none()) return None;
+
+                return std::invoke(std::forward<F>(f),
+                                   std::forward<Self>(self).payload());
+            }
+
+            /// This Option if it is Some, otherwise `f()`.
+            template <class Self, class F>
+            requires std::convertible_to<std::invoke_result_t<F>, Option>
+            constexpr auto or_else(this Self&& self, F&& f) noexcept(
+                std::is_nothrow_invocable_v<F>) -> Option {
+
+                if (self.is_some()) return std::forward<Self>(self);
+
+                return std::invoke(std::forward<F>(f));
+            }
+
+            /// Calls f with a const reference to the value, if any.
+            template <class Self, class F>
+            constexpr auto inspect(this Self&& self, F&& f) noexcept(
+                std::is_nothrow_invocable_v<F, const std::remove_cvref_t<T>&>)
+                -> Self {
+
+                if (self.is_some())
+                    std::invoke(std::forward<F>(f),
+                                std::as_const(self._value.get()));
+
+                return std::forward<Self>(self);
+            }
+
+            /// Option<Option<U>> to Option<U>.
+            template <class Self>
+            requires impl::IsOption<T>
+            constexpr auto flatten(this Self&& self) noexcept -> T {
+
+                if (self.is_none()) return None;
+
+                return std::forward<Self>(self).payload();
+            }
+
+            /// Option<Result<U, E>> to Result<Option<U>, E>.
+            template <class Self,
+                      class U = typename std::remove_cvref_t<Self>::Value>
+            constexpr auto transpose(this Self&& self) noexcept
+                -> decltype(impl::OptionTranspose<U>::apply(
+                    std::forward<Self>(self))) {
+                return impl::OptionTranspose<U>::apply(
+                    std::forward<Self>(self));
+            }
+
+            /// A view of the value that borrows instead of copying.
+            [[nodiscard]] constexpr auto as_ref() const noexcept
+                -> Option<const std::remove_reference_t<T>&> {
+
+                using U = const std::remove_reference_t<T>&;
+
+                if (this->is_none()) return None;
+
+                return Some<U>(_value.get());
+            }
+
+            /// A mutable view of the value.
+            [[nodiscard]] constexpr auto as_mut() noexcept
+                -> Option<std::remove_reference_t<T>&> {
+
+                using U = std::remove_reference_t<T>&;
+
+                if (this->is_none()) return None;
+
+                return Some<U>(_value.get());
             }
 
-            auto swap(Option& other) noexcept -> void {
+            /// Moves the value out and leaves None behind.
+            constexpr auto take() noexcept -> Option {
+                return std::exchange(*this, Option(None));
+            }
+
+            /// Puts value in and returns what was there before.
+            constexpr auto replace(T value) noexcept -> Option {
+                return std::exchange(*this,
+                                     Option(Some<T>(std::forward<T>(value))));
+            }
+
+            constexpr auto swap(Option& other) noexcept -> void {
                 std::swap(_value, other._value);
             }
 
-            auto operator==(const Option& other) const noexcept -> bool {
-                return _value == other._value;
+            constexpr auto operator==(const Option& other) const noexcept
+                -> bool {
+
+                if (this->is_some() != other.is_some()) return false;
+
+                return this->is_none() || _value.get() == other._value.get();
             }
 
-            auto operator==(NoneType) const noexcept -> bool {
+            constexpr auto operator==(NoneType) const noexcept -> bool {
                 return this->is_none();
             }
 
-            operator bool() const noexcept {
+            constexpr operator bool() const noexcept {
                 return this->is_some();
             }
 
         private:
-            std::optional<T> _value;
+            template <class Self>
+            constexpr auto payload(this Self&& self) noexcept -> Payload<Self> {
+
+                // Option<T&> hands out the reference it holds as is
+                if constexpr (std::is_reference_v<T>)
+                    return self._value.get();
+                else
+                    return std::forward_like<Self>(self._value.get());
+            }
+
+        private:
+            impl::OptionStorage<T> _value;
     };
 
 }; // namespace lx::core
+
+/// An Option is Send when the value it may hold is
+template <class T>
+struct lx::trait::UnsafeSendMarker<lx::core::Option<T>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+/// Option<T&> holds a pointer; other Options hold a T and maybe a flag
+template <class T>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<lx::core::Option<T>> {
+        static constexpr auto value =
+            std::is_reference_v<T> || lx::trait::TriviallyRelocatable<T>;
+};
@@ -0,0 +1,117 @@
+#include "lastix/core/pool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace lx::core::impl {
+
+    SlabPool::SlabPool(usize slot_size, usize slot_align) noexcept
+        : _slot_size(slot_size),
+          _slab_align(std::max(slot_align, alignof(PoolSlab))),
+          _slots_offset((sizeof(PoolSlab) + slot_align - 1) / slot_align *
+                        slot_align) {
+    }
+
+    SlabPool::~SlabPool() noexcept {
+
+        auto* slab = _slabs.load(std::memory_order_acquire);
+
+        while (slab != nullptr)
+            ::operator delete(std::exchange(slab, slab->next),
+                              std::align_val_t(_slab_align));
+    }
+
+    auto SlabPool::take_batch() noexcept -> PoolSlot* {
+
+        auto head = _free.load(std::memory_order_acquire);
+
+        while (auto* top = slot(head)) {
+            auto* below = top->next_batch.load(std::memory_order_relaxed);
+            auto next = reinterpret_cast<std::uintptr_t>(below) |
+                        ((head & ~pointer_mask) + tag_one);
+
+            if (_free.compare_exchange_weak(head, next,
+                                            std::memory_order_acquire,
+                                            std::memory_order_acquire))
+                return top;
+        }
+
+        return this->allocate_slab();
+    }
+
+    auto SlabPool::give_batch(PoolSlot* chain) noexcept -> void {
+
+        auto address =
+            static_cast<u64>(reinterpret_cast<std::uintptr_t>(chain));
+        auto head = _free.load(std::memory_order_relaxed);
+
+        do {
+            chain->next_batch.store(slot(head), std::memory_order_relaxed);
+        } while (!_free.compare_exchange_weak(
+            head, address | ((head & ~pointer_mask) + tag_one),
+            std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    auto SlabPool::allocate_slab() noexcept -> PoolSlot* {
+
+        auto* slab = static_cast<std::byte*>(::operator new(
+            _slots_offset + batch * _slot_size, std::align_val_t(_slab_align),
+            std::nothrow));
+
+        if (slab == nullptr) [[unlikely]]
+            panic("Pool is out of memory");
+
+        auto* memory = slab + _slots_offset;
+        if ((reinterpret_cast<std::uintptr_t>(memory) & ~pointer_mask) != 0)
+            [[unlikely]]
+            panic("Pool slab address does not fit the packed free list");
+
+        auto* header = new (slab)
+            PoolSlab{_slabs.load(std::memory_order_relaxed)};
+        while (!_slabs.compare_exchange_weak(header->next, header,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+        }
+
+        for (auto i = usize{0}; i < batch; i++) {
+            auto* next =
+                i + 1 < batch
+                    ? reinterpret_cast<PoolSlot*>(memory + (i + 1) * _slot_size)
+                    : nullptr;
+            new (memory + i * _slot_size) PoolSlot{next, nullptr, 0};
+        }
+
+        auto* first = reinterpret_cast<PoolSlot*>(memory);
+        first->size = batch;
+        return first;
+    }
+
+    PoolCache::~PoolCache() noexcept {
+
+        if (_head == nullptr) return;
+
+        _head->size = _count;
+        _pool.give_batch(std::exchange(_head, nullptr));
+        _count = 0;
+    }
+
+    auto PoolCache::refill() noexcept -> void {
+        _head = _pool.take_batch();
+        _count = _head->size;
+    }
+
+    auto PoolCache::flush() noexcept -> void {
+
+        // Keep the most recently freed slots, they are likely still in the
+        // CPU cache, and give back the older ones
+        auto* last = _head;
+        for (auto i = usize{1}; i < SlabPool::batch; i++) last = last->next;
+
+        auto* rest = std::exchange(last->next, nullptr);
+        rest->size = _count - SlabPool::batch;
+        _pool.give_batch(rest);
+        _count = SlabPool::batch;
+    }
+
+}; // namespace lx::core::impl
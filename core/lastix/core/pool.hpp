@@ -0,0 +1,258 @@
+#pragma once
+
+#include "lastix/core/arc.hpp"
+#include "lastix/core/box.hpp"
+#include "lastix/core/memory.hpp"
+#include "lastix/core/number.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace lx::core {
+
+    template <class T> class Pool;
+
+    namespace impl {
+
+        /// A free slot. The first slot of a batch also heads the batch.
+        struct PoolSlot {
+                PoolSlot* next;
+
+                // Read by take_batch() on threads racing with the one that
+                // popped this batch and may already be reusing the slot
+                std::atomic<PoolSlot*> next_batch;
+
+                usize size;
+        };
+
+        /// Start of every slab, linking all of them for ~SlabPool.
+        struct PoolSlab {
+                PoolSlab* next;
+        };
+
+        /**
+         * @brief Slots of one size shared by all threads.
+         *
+         * Free slots travel between threads in batches, kept on a lock-free
+         * stack. The stack head packs the batch pointer with a tag that
+         * every update bumps, so a batch popped and pushed back in between
+         * is not mistaken for the old head. The tag has 16 bits on 64-bit
+         * targets and wraps: a thread stalled between reading the head and
+         * its CAS for exactly a multiple of 65536 updates, with the same
+         * batch on top again, would still be fooled.
+         *
+         * Slabs stay allocated while the pool lives, which is what makes
+         * reading a popped batch's link safe. They are chained through a
+         * plain pointer at their start, apart from the tagged stack, and
+         * freed by the destructor.
+         */
+        class SlabPool {
+
+            public:
+                /// Slots moved between a thread cache and the pool at once.
+                static constexpr auto batch = usize{32};
+
+                SlabPool(usize slot_size, usize slot_align) noexcept;
+
+                /// Frees every slab; no slot may be in use any more.
+                ~SlabPool() noexcept;
+
+                SlabPool(const SlabPool&) = delete;
+                auto operator=(const SlabPool&) -> SlabPool& = delete;
+
+                /// A chain of free slots; a fresh slab if none are left.
+                [[nodiscard]] auto take_batch() noexcept -> PoolSlot*;
+
+                /// Takes back a chain headed by a slot with its size set.
+                auto give_batch(PoolSlot* chain) noexcept -> void;
+
+            private:
+                static_assert(std::atomic<u64>::is_always_lock_free);
+
+                static constexpr auto pointer_bits =
+                    sizeof(void*) == 8 ? usize{48} : usize{32};
+                static constexpr auto tag_one = u64{1} << pointer_bits;
+                static constexpr auto pointer_mask = tag_one - 1;
+
+                static auto slot(u64 head) noexcept -> PoolSlot* {
+                    return reinterpret_cast<PoolSlot*>(
+                        static_cast<std::uintptr_t>(head & pointer_mask));
+                }
+
+                auto allocate_slab() noexcept -> PoolSlot*;
+
+            private:
+                std::atomic<u64> _free = 0;
+                std::atomic<PoolSlab*> _slabs = nullptr;
+                usize _slot_size;
+                usize _slab_align;
+
+                /// Offset of the first slot, past the PoolSlab header.
+                usize _slots_offset;
+        };
+
+        /**
+         * @brief Free slots owned by one thread. Allocation and release are
+         * a pop and a push on a plain list; the shared pool is only touched
+         * to refill an empty cache or to hand back a batch once the cache
+         * holds two of them.
+         */
+        class PoolCache {
+
+            public:
+                explicit PoolCache(SlabPool& pool) noexcept : _pool(pool) {
+                }
+
+                /// Gives every cached slot back to the pool.
+                ~PoolCache() noexcept;
+
+                PoolCache(const PoolCache&) = delete;
+                auto operator=(const PoolCache&) -> PoolCache& = delete;
+
+                [[nodiscard]] auto pop() noexcept -> void* {
+
+                    if (_head == nullptr) [[unlikely]]
+                        this->refill();
+
+                    auto* slot = _head;
+                    _head = slot->next;
+                    _count -= 1;
+
+                    return slot;
+                }
+
+                auto push(void* memory) noexcept -> void {
+
+                    auto* slot = static_cast<PoolSlot*>(memory);
+                    slot->next = _head;
+                    _head = slot;
+
+                    if (++_count >= 2 * SlabPool::batch) [[unlikely]]
+                        this->flush();
+                }
+
+            private:
+                auto refill() noexcept -> void;
+                auto flush() noexcept -> void;
+
+            private:
+                SlabPool& _pool;
+                PoolSlot* _head = nullptr;
+                usize _count = 0;
+        };
+
+        /**
+         * @brief Allocator that takes single slots from Pool<T>. U is the
+         * type actually placed there: T itself for a Box, the control block
+         * holding T for an Arc.
+         */
+        template <class T, class U = T> class PoolAllocator {
+
+            public:
+                using value_type = U;
+
+                template <class V> struct rebind {
+                        using other = PoolAllocator<T, V>;
+                };
+
+                PoolAllocator() noexcept = default;
+
+                template <class V>
+                PoolAllocator(const PoolAllocator<T, V>&) noexcept {
+                }
+
+                [[nodiscard]] auto allocate(usize n) noexcept -> U* {
+                    static_assert(sizeof(U) <= Pool<T>::slot_size &&
+                                  alignof(U) <= Pool<T>::slot_align);
+
+                    if (n != 1) [[unlikely]]
+                        panic("Pool slots hold a single object");
+
+                    return static_cast<U*>(Pool<T>::allocate());
+                }
+
+                auto deallocate(U* ptr, usize) noexcept -> void {
+                    Pool<T>::deallocate(ptr);
+                }
+
+                template <class V>
+                auto operator==(const PoolAllocator<T, V>&) const noexcept
+                    -> bool {
+                    return true;
+                }
+        };
+
+    }; // namespace impl
+
+    /// Box whose value lives in a Pool<T> slot; still pointer-sized.
+    template <class T>
+    using PoolBox = Box<T, AllocatorDeleter<T, impl::PoolAllocator<T>>>;
+
+    /**
+     * @brief Slab allocator for one fixed-size type, shared by the program.
+     *
+     * Every thread allocates from and frees into its own cache of slots, so
+     * the common case is a few instructions without atomics. A slot can be
+     * freed on any thread. Slots are large enough for an Arc control block
+     * holding a T, so make_arc() needs a single slot as well. Memory taken
+     * by the pool is kept for reuse and only given back at exit.
+     */
+    template <class T> class Pool {
+
+            using ArcBlock = impl::ArcAllocBlock<T, impl::PoolAllocator<T>>;
+
+        public:
+            static constexpr auto slot_align = std::max(
+                {alignof(T), alignof(ArcBlock), alignof(impl::PoolSlot)});
+
+            static constexpr auto slot_size =
+                (std::max({sizeof(T), sizeof(ArcBlock),
+                           sizeof(impl::PoolSlot)}) +
+                 slot_align - 1) /
+                slot_align * slot_align;
+
+            Pool() = delete;
+
+            /// Uninitialized memory for one T.
+            [[nodiscard]] static auto allocate() noexcept -> void* {
+                return cache().pop();
+            }
+
+            static auto deallocate(void* slot) noexcept -> void {
+                cache().push(slot);
+            }
+
+            template <class... Args>
+            requires std::constructible_from<T, Args...>
+            [[nodiscard]] static auto make_box(Args&&... args) noexcept
+                -> PoolBox<T> {
+                return Box<T>::new_in(impl::PoolAllocator<T>(),
+                                      std::forward<Args>(args)...);
+            }
+
+            /// Arc whose counts and value share one slot.
+            template <class... Args>
+            requires std::constructible_from<T, Args...>
+            [[nodiscard]] static auto make_arc(Args&&... args) noexcept
+                -> Arc<T> {
+                return Arc<T>::new_in(impl::PoolAllocator<T>(),
+                                      std::forward<Args>(args)...);
+            }
+
+        private:
+            static auto shared() noexcept -> impl::SlabPool& {
+                static auto pool = impl::SlabPool(slot_size, slot_align);
+                return pool;
+            }
+
+            static auto cache() noexcept -> impl::PoolCache& {
+                thread_local auto cache = impl::PoolCache(shared());
+                return cache;
+            }
+    };
+
+}; // namespace lx::core
@@ -0,0 +1,509 @@
+#pragma once
+
+#include "lastix/core/diagnostics.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/memory.hpp"
+#include "lastix/trait/niche.hpp"
+#include "lastix/trait/relocatable.hpp"
+#include "lastix/trait/send.hpp"
+
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace lx::core {
+
+    namespace impl {
+
+        /**
+         * @brief Reference counts shared by all Rc and RcWeak handles to one
+         * value. Same protocol as ArcControlBlock, with plain integers: the
+         * value is destroyed when strong_count reaches zero, the block when
+         * weak_count does, and the strong handles share one weak reference.
+         */
+        struct RcControlBlock {
+
+                /// Counts past this point panic instead of wrapping around.
+                static constexpr auto max_count =
+                    std::numeric_limits<usize>::max() / 2;
+
+                RcControlBlock(usize strong, usize weak) noexcept
+                    : strong_count(strong), weak_count(weak) {
+                }
+
+                virtual ~RcControlBlock() noexcept = default;
+
+                /// Destroys the managed value. Called once, on the last drop.
+                virtual auto drop_value() noexcept -> void = 0;
+
+                auto retain() noexcept -> void {
+                    if (strong_count++ > max_count) [[unlikely]]
+                        panic("Rc reference count overflow");
+                }
+
+                auto release() noexcept -> void {
+                    if (--strong_count != 0) return;
+
+                    this->drop_value();
+                    this->release_weak();
+                }
+
+                /// Takes a strong reference unless the value has been dropped.
+                [[nodiscard]] auto try_retain() noexcept -> bool {
+                    if (strong_count == 0) return false;
+
+                    this->retain();
+                    return true;
+                }
+
+                auto retain_weak() noexcept -> void {
+                    if (weak_count++ > max_count) [[unlikely]]
+                        panic("Rc weak reference count overflow");
+                }
+
+                auto release_weak() noexcept -> void {
+                    if (--weak_count == 0) delete this;
+                }
+
+                usize strong_count = 0;
+                usize weak_count = 0;
+        };
+
+        /**
+         * @brief Split layout: the value lives in its own allocation and is
+         * released through Deleter. Used by unsafe_from_raw() and by Rcs with
+         * a custom deleter.
+         */
+        template <class T, class Deleter>
+        struct RcPointerBlock final : RcControlBlock {
+
+                explicit RcPointerBlock(T* data) noexcept
+                    : RcControlBlock(1, 1), ptr(data) {
+                }
+
+                auto drop_value() noexcept -> void override {
+                    Deleter{}(std::exchange(ptr, nullptr));
+                }
+
+                T* ptr = nullptr;
+        };
+
+        /**
+         * @brief Fused layout: the counts and the value share one allocation,
+         * so constructing an Rc costs a single `new` and the first access to
+         * the value touches the cache line the counts were just written to.
+         */
+        template <class T> struct RcInplaceBlock final : RcControlBlock {
+
+                template <class... Args>
+                explicit RcInplaceBlock(Args&&... args) noexcept
+                    : RcControlBlock(1, 1),
+                      value(std::forward<Args>(args)...) {
+                }
+
+                // The value is destroyed by drop_value(), never here
+                ~RcInplaceBlock() noexcept override {
+                }
+
+                auto drop_value() noexcept -> void override {
+                    std::destroy_at(&value);
+                }
+
+                union {
+                        T value;
+                };
+        };
+
+    }; // namespace impl
+
+    template <class T, class Deleter> class RcWeak;
+
+    /**
+     * @brief Single-threaded counterpart of Arc.
+     *
+     * Same API and layout as Arc, but the counts are plain integers, so
+     * cloning and dropping cost no atomic RMW. Rc is not lx::trait::Send:
+     * lx::core::spawn() rejects it at compile time, and every handle to one
+     * value has to stay on the thread that created it.
+     */
+    template <class T, class Deleter = DefaultDeleter<T>> class Rc {
+
+        public:
+            /**
+             * @brief Constructs T in place.
+             *
+             * With the default deleter the value is placed inside the control
+             * block (one allocation). A custom deleter expects a pointer it
+             * can free on its own, so that case keeps the split layout.
+             */
+            template <class... Args>
+            requires std::constructible_from<T, Args...>
+            explicit Rc(Args&&... args) noexcept {
+
+                if constexpr (std::same_as<Deleter, DefaultDeleter<T>>) {
+                    auto* cb = new impl::RcInplaceBlock<T>(
+                        std::forward<Args>(args)...);
+                    _data = &cb->value;
+                    _cb = cb;
+                } else {
+                    _data = new T(std::forward<Args>(args)...);
+                    _cb = new impl::RcPointerBlock<T, Deleter>(_data);
+                }
+            }
+
+            Rc(Rc&& other) noexcept
+                : _data(std::exchange(other._data, nullptr)),
+                  _cb(std::exchange(other._cb, nullptr)) {
+            }
+
+            Rc(const Rc& other) noexcept
+                : _data(other._data), _cb(other._cb) {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _cb->retain();
+            }
+
+            auto operator=(Rc&& other) noexcept -> Rc& {
+                if (this != &other) {
+                    this->reset();
+                    _data = std::exchange(other._data, nullptr);
+                    _cb = std::exchange(other._cb, nullptr);
+                }
+
+                return *this;
+            }
+
+            auto operator=(const Rc& other) noexcept -> Rc& {
+                if (this != &other) {
+                    this->reset();
+
+                    if (other._cb != nullptr) {
+                        other._cb->retain();
+                        _data = other._data;
+                        _cb = other._cb;
+                    }
+                }
+
+                return *this;
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            explicit Rc(Rc<U>&& other) noexcept
+                : _data(static_cast<T*>(std::exchange(other._data, nullptr))),
+                  _cb(std::exchange(other._cb, nullptr)) {
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            explicit Rc(const Rc<U>& other) noexcept
+                : _data(static_cast<T*>(other._data)), _cb(other._cb) {
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _cb->retain();
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            auto operator=(Rc<U>&& other) -> Rc& {
+                this->reset();
+                _data = static_cast<T*>(std::exchange(other._data, nullptr));
+                _cb = std::exchange(other._cb, nullptr);
+                return *this;
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            auto operator=(const Rc<U>& other) -> Rc& {
+                this->reset();
+                if (other._cb) [[likely]] {
+
+                    other._cb->retain();
+
+                    _data = static_cast<T*>(other._data);
+                    _cb = other._cb;
+                }
+                return *this;
+            }
+
+            ~Rc() noexcept {
+                this->reset();
+            }
+
+            [[nodiscard]] static auto unsafe_from_raw(T* data) noexcept
+                -> Rc<T, Deleter> {
+
+                return Rc(data, new impl::RcPointerBlock<T, Deleter>(data));
+            }
+
+            auto reset() noexcept -> void {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _data = nullptr;
+                std::exchange(_cb, nullptr)->release();
+            }
+
+            /**
+             * @brief Creates an RcWeak handle to the same value. An RcWeak
+             * keeps the control block, but not the value, alive.
+             */
+            [[nodiscard]] auto downgrade() const noexcept
+                -> RcWeak<T, Deleter> {
+                if (_cb == nullptr) [[unlikely]]
+                    return RcWeak<T, Deleter>();
+
+                _cb->retain_weak();
+                return RcWeak<T, Deleter>(_data, _cb);
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> const T* {
+
+                if (_data == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return _data;
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> const T& {
+
+                if (_data == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return *_data;
+            }
+
+            /**
+             * @brief Mutable access, unlike Arc's, is not gated on
+             * lx::trait::Sync: every handle to the value lives on one thread,
+             * so a write through one Rc cannot race a read through another.
+             * Keeping two references obtained this way alive at once is
+             * still the caller's business, as with any shared T&.
+             */
+            [[nodiscard]] auto operator->() noexcept -> T* {
+
+                if (_data == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return _data;
+            }
+
+            [[nodiscard]] auto operator*() noexcept -> T& {
+
+                if (_data == nullptr) [[unlikely]]
+                    panic("Dereferencing nullptr");
+
+                return *_data;
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept {
+                return _data != nullptr;
+            }
+
+            auto swap(Rc& other) noexcept -> void {
+                std::swap(_data, other._data);
+                std::swap(_cb, other._cb);
+            }
+
+            auto unsafe_get() const& noexcept -> const T* {
+                return _data;
+            }
+
+            [[nodiscard]] auto strong_count() const noexcept -> Option<usize> {
+                if (_cb == nullptr) [[unlikely]]
+                    return None;
+
+                return Some(_cb->strong_count);
+            }
+
+            [[nodiscard]] auto weak_count() const noexcept -> Option<usize> {
+                if (_cb == nullptr) [[unlikely]]
+                    return None;
+
+                // Discount the weak reference held by the strong handles
+                return Some(_cb->weak_count - 1);
+            }
+
+        private:
+            Rc(T* data, impl::RcControlBlock* cb) noexcept
+                : _data(data), _cb(cb) {
+            }
+
+            template <class U, class Del> friend class Rc;
+            template <class U, class Del> friend class RcWeak;
+
+        private:
+            T* _data = nullptr;
+            impl::RcControlBlock* _cb = nullptr;
+    };
+
+    /**
+     * @brief Non-owning handle to a value managed by Rc.
+     *
+     * An RcWeak does not keep the value alive and cannot be dereferenced. It
+     * has to be upgraded to an Rc first, which fails once the last Rc is gone.
+     * Use it for back-references that would otherwise form a cycle.
+     */
+    template <class T, class Deleter = DefaultDeleter<T>> class RcWeak {
+
+        public:
+            /// Creates an empty RcWeak that never upgrades.
+            RcWeak() noexcept = default;
+
+            RcWeak(RcWeak&& other) noexcept
+                : _data(std::exchange(other._data, nullptr)),
+                  _cb(std::exchange(other._cb, nullptr)) {
+            }
+
+            RcWeak(const RcWeak& other) noexcept
+                : _data(other._data), _cb(other._cb) {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _cb->retain_weak();
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            explicit RcWeak(RcWeak<U>&& other) noexcept
+                : _data(static_cast<T*>(std::exchange(other._data, nullptr))),
+                  _cb(std::exchange(other._cb, nullptr)) {
+            }
+
+            template <class U>
+            requires std::derived_from<U, T>
+            explicit RcWeak(const RcWeak<U>& other) noexcept
+                : _data(static_cast<T*>(other._data)), _cb(other._cb) {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _cb->retain_weak();
+            }
+
+            auto operator=(RcWeak&& other) noexcept -> RcWeak& {
+                if (this != &other) {
+                    this->reset();
+                    _data = std::exchange(other._data, nullptr);
+                    _cb = std::exchange(other._cb, nullptr);
+                }
+
+                return *this;
+            }
+
+            auto operator=(const RcWeak& other) noexcept -> RcWeak& {
+                if (this != &other) {
+                    this->reset();
+
+                    if (other._cb != nullptr) {
+                        other._cb->retain_weak();
+                        _data = other._data;
+                        _cb = other._cb;
+                    }
+                }
+
+                return *this;
+            }
+
+            ~RcWeak() noexcept {
+                this->reset();
+            }
+
+            /**
+             * @brief Attempts to obtain a strong reference.
+             * @return Some(Rc) while at least one Rc is alive, None after the
+             * value has been dropped or if this RcWeak is empty.
+             */
+            [[nodiscard]] auto upgrade() const noexcept
+                -> Option<Rc<T, Deleter>> {
+
+                if (_cb == nullptr || !_cb->try_retain()) return None;
+
+                return Some(Rc<T, Deleter>(_data, _cb));
+            }
+
+            auto reset() noexcept -> void {
+
+                if (_cb == nullptr) [[unlikely]]
+                    return;
+
+                _data = nullptr;
+                std::exchange(_cb, nullptr)->release_weak();
+            }
+
+            auto swap(RcWeak& other) noexcept -> void {
+                std::swap(_data, other._data);
+                std::swap(_cb, other._cb);
+            }
+
+            [[nodiscard]] auto strong_count() const noexcept -> Option<usize> {
+                if (_cb == nullptr) [[unlikely]]
+                    return None;
+
+                return Some(_cb->strong_count);
+            }
+
+            [[nodiscard]] auto weak_count() const noexcept -> Option<usize> {
+                if (_cb == nullptr) [[unlikely]]
+                    return None;
+
+                auto weak = _cb->weak_count;
+
+                // While the value is alive one weak reference belongs to the
+                // strong handles
+                if (_cb->strong_count != 0) weak -= 1;
+
+                return Some(weak);
+            }
+
+        private:
+            RcWeak(T* data, impl::RcControlBlock* cb) noexcept
+                : _data(data), _cb(cb) {
+            }
+
+            template <class U, class Del> friend class Rc;
+            template <class U, class Del> friend class RcWeak;
+
+        private:
+            T* _data = nullptr;
+            impl::RcControlBlock* _cb = nullptr;
+    };
+
+}; // namespace lx::core
+
+/// Rc counts are not atomic, so no handle may leave its thread
+template <class T, class Deleter>
+struct lx::trait::UnsafeSendMarker<lx::core::Rc<T, Deleter>> {
+        static constexpr auto value = false;
+};
+
+template <class T, class Deleter>
+struct lx::trait::UnsafeSendMarker<lx::core::RcWeak<T, Deleter>> {
+        static constexpr auto value = false;
+};
+
+/// An Rc never points at address 1, even when empty or moved from
+template <class T, class Deleter>
+struct lx::trait::UnsafeNicheMarker<lx::core::Rc<T, Deleter>> {
+        static constexpr auto value = true;
+        static constexpr auto offset = std::size_t{0};
+        static constexpr auto none = lx::trait::pointer_niche;
+};
+
+/// Handles are just pointers; the counts live in the control block
+template <class T, class Deleter>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<lx::core::Rc<T, Deleter>> {
+        static constexpr auto value = true;
+};
+
+template <class T, class Deleter>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<
+    lx::core::RcWeak<T, Deleter>> {
+        static constexpr auto value = true;
+};
@@ -1,14 +1,26 @@
 #pragma once
 
 #include "lastix/core/diagnostics.hpp"
+#include "lastix/core/number.hpp"
 #include "lastix/core/option.hpp"
+#include "lastix/core/static_str.hpp"
 #include "lastix/trait/from.hpp"
-
-#include <variant>
+#include "lastix/trait/niche.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
 #include <utility>
 
 namespace lx::core {
 
+    template <class T, class E> class Result;
+
     namespace impl {
 
         /**
@@ -24,7 +36,7 @@ namespace lx::core {
                  * @brief Constructs the tagged value.
                  * @param value Value to store (moved in).
                  */
-                explicit ResultTaggedValue(T value) noexcept
+                constexpr explicit ResultTaggedValue(T value) noexcept
                     : _value(std::move(value)) {
                 }
 
@@ -33,14 +45,16 @@ namespace lx::core {
                  * Preserves value category (lvalue/rvalue).
                  */
                 template <class Self>
-                auto operator*(this Self&& self) noexcept -> decltype(auto) {
+                constexpr auto operator*(this Self&& self) noexcept
+                    -> decltype(auto) {
                     return std::forward_like<Self>(self._value);
                 }
 
                 /**
                  * @brief Equality comparison.
                  */
-                auto operator==(const ResultTaggedValue& other) const noexcept
+                constexpr auto operator==(
+                    const ResultTaggedValue& other) const noexcept
                     -> bool {
                     return _value == other._value;
                 }
@@ -65,16 +79,6 @@ namespace lx::core {
         /// Tag type representing failed result.
         struct ErrTag {};
 
-        /// Deduction guide to handle nested Ok(Ok(...)).
-        template <class U>
-        ResultTaggedValue(ResultTaggedValue<U, OkTag>)
-            -> ResultTaggedValue<ResultTaggedValue<U, OkTag>, OkTag>;
-
-        /// Deduction guide to handle nested Err(Err(...)).
-        template <class U>
-        ResultTaggedValue(ResultTaggedValue<U, ErrTag>)
-            -> ResultTaggedValue<ResultTaggedValue<U, ErrTag>, ErrTag>;
-
         /// Empty placeholder for void-type variants.
         struct Empty {};
 
@@ -90,21 +94,401 @@ namespace lx::core {
         /// Shorthand alias for VoidOrTypeHelper.
         template <class T> using VoidOrType = VoidOrTypeHelper<T>::type;
 
+        template <class T> struct IsResultHelper : std::false_type {};
+        template <class T, class E>
+        struct IsResultHelper<Result<T, E>> : std::true_type {};
+
+        /// T is some Result<U, F>.
+        template <class T>
+        concept IsResult = IsResultHelper<std::remove_cvref_t<T>>::value;
+
+        /// A of a Result as forwarded out of a Self of that value category.
+        template <class Self, class A>
+        using Forwarded = decltype(std::forward_like<Self>(std::declval<A&>()));
+
+        /// Calls f with a Result arm, or with nothing when the arm is void.
+        template <class T, class F, class A>
+        constexpr auto invoke_arm(F&& f, A&& arm) noexcept -> decltype(auto) {
+            if constexpr (std::is_void_v<T>)
+                return std::invoke(std::forward<F>(f));
+            else
+                return std::invoke(std::forward<F>(f), std::forward<A>(arm));
+        }
+
+        template <class T, class F, class A>
+        using ArmResult =
+            decltype(invoke_arm<T>(std::declval<F>(), std::declval<A>()));
+
+        template <class T, class F, class A>
+        concept NothrowArm = (std::is_void_v<T>
+                                  ? std::is_nothrow_invocable_v<F>
+                                  : std::is_nothrow_invocable_v<F, A>);
+
         /// Concept requiring that a type has a context() method.
         template <class T>
         concept WithContext = requires(T t) { t.context(""); };
 
+        /// A callable whose result can be passed to E::context().
+        template <class F, class E>
+        concept ContextFn =
+            requires(E e, F f) { e.context(std::invoke(std::forward<F>(f))); };
+
+        /// E has a context_fmt() taking these format arguments.
+        template <class E, class... Args>
+        concept WithContextFmt = requires(E e, std::format_string<Args...> fmt,
+                                          Args&&... args) {
+            e.context_fmt(fmt, std::forward<Args>(args)...);
+        };
+
+        /// Both Result arms can be copied.
+        template <class V, class E>
+        concept CopyableArms =
+            std::is_copy_constructible_v<V> && std::is_copy_constructible_v<E>;
+
+        /// Both Result arms can be copied with memcpy.
+        template <class V, class E>
+        concept TriviallyCopyableArms =
+            CopyableArms<V, E> && std::is_trivially_copyable_v<V> &&
+            std::is_trivially_copyable_v<E>;
+
+        /**
+         * @brief Result storage with an explicit tag next to a union.
+         *
+         * Every special member is trivial when it is trivial for both arms,
+         * so e.g. Result<i32, ErrorCode> is trivially copyable and returned
+         * in registers.
+         */
+        template <class V, class E> class ResultTaggedStorage {
+
+            public:
+                template <class U>
+                constexpr ResultTaggedStorage(OkTag, U&& value) noexcept
+                    : _ok(std::forward<U>(value)), _is_ok(true) {
+                }
+
+                template <class U>
+                constexpr ResultTaggedStorage(ErrTag, U&& error) noexcept
+                    : _err(std::forward<U>(error)), _is_ok(false) {
+                }
+
+                constexpr ResultTaggedStorage(
+                    const ResultTaggedStorage&) noexcept
+                requires TriviallyCopyableArms<V, E>
+                = default;
+
+                constexpr ResultTaggedStorage(
+                    const ResultTaggedStorage& other) noexcept
+                requires CopyableArms<V, E>
+                    : _is_ok(other._is_ok) {
+                    this->construct_from(other);
+                }
+
+                constexpr ResultTaggedStorage(ResultTaggedStorage&&) noexcept
+                requires TriviallyCopyableArms<V, E>
+                = default;
+
+                constexpr ResultTaggedStorage(
+                    ResultTaggedStorage&& other) noexcept
+                    : _is_ok(other._is_ok) {
+                    this->construct_from(std::move(other));
+                }
+
+                constexpr ~ResultTaggedStorage() noexcept
+                requires(std::is_trivially_destructible_v<V> &&
+                         std::is_trivially_destructible_v<E>)
+                = default;
+
+                constexpr ~ResultTaggedStorage() noexcept {
+                    this->destroy();
+                }
+
+                constexpr auto operator=(const ResultTaggedStorage&) noexcept
+                    -> ResultTaggedStorage&
+                requires TriviallyCopyableArms<V, E>
+                = default;
+
+                constexpr auto operator=(
+                    const ResultTaggedStorage& other) noexcept
+                    -> ResultTaggedStorage&
+                requires CopyableArms<V, E>
+                {
+                    if (this != &other) [[likely]] {
+                        this->destroy();
+                        _is_ok = other._is_ok;
+                        this->construct_from(other);
+                    }
+
+                    return *this;
+                }
+
+                constexpr auto operator=(ResultTaggedStorage&&) noexcept
+                    -> ResultTaggedStorage&
+                requires TriviallyCopyableArms<V, E>
+                = default;
+
+                constexpr auto operator=(ResultTaggedStorage&& other) noexcept
+                    -> ResultTaggedStorage& {
+
+                    if (this != &other) [[likely]] {
+                        this->destroy();
+                        _is_ok = other._is_ok;
+                        this->construct_from(std::move(other));
+                    }
+
+                    return *this;
+                }
+
+                [[nodiscard]] constexpr auto is_ok() const noexcept -> bool {
+                    return _is_ok;
+                }
+
+                template <class Self>
+                [[nodiscard]] constexpr auto ok(this Self&& self) noexcept
+                    -> decltype(auto) {
+                    return std::forward_like<Self>(self._ok);
+                }
+
+                template <class Self>
+                [[nodiscard]] constexpr auto err(this Self&& self) noexcept
+                    -> decltype(auto) {
+                    return std::forward_like<Self>(self._err);
+                }
+
+            private:
+                /// Constructs the arm selected by _is_ok from other's.
+                template <class Other>
+                constexpr auto construct_from(Other&& other) noexcept -> void {
+                    if (_is_ok)
+                        std::construct_at(&_ok,
+                                          std::forward_like<Other>(other._ok));
+                    else
+                        std::construct_at(
+                            &_err, std::forward_like<Other>(other._err));
+                }
+
+                constexpr auto destroy() noexcept -> void {
+                    if (_is_ok)
+                        std::destroy_at(&_ok);
+                    else
+                        std::destroy_at(&_err);
+                }
+
+            private:
+                union {
+                        V _ok;
+                        E _err;
+                };
+
+                bool _is_ok;
+        };
+
+        /**
+         * @brief Result storage without a tag: one arm, the host, has a
+         * lx::trait::Niche and the other arm, the guest, is placed after the
+         * niche word. While the guest is alive, the niche word holds the
+         * niche pattern, so it tells both arms apart.
+         *
+         * Used when it is smaller than ResultTaggedStorage, e.g.
+         * Result<Box<T>, Error> is no larger than Error itself: the Box goes
+         * into Error's inline payload buffer. Like the niche storage of
+         * Option, it only works at run time.
+         */
+        template <class V, class E, bool OkHosts> class ResultNicheStorage {
+
+                using Host = std::conditional_t<OkHosts, V, E>;
+                using Guest = std::conditional_t<OkHosts, E, V>;
+                using Niche = lx::trait::UnsafeNicheMarker<Host>;
+
+                // The guest starts at the first aligned byte after the niche
+                static constexpr auto niche_end =
+                    Niche::offset + sizeof(std::uintptr_t);
+                static constexpr auto guest_offset =
+                    (niche_end + alignof(Guest) - 1) & ~(alignof(Guest) - 1);
+
+            public:
+                template <class U>
+                ResultNicheStorage(OkTag, U&& value) noexcept {
+                    this->construct<OkHosts>(std::forward<U>(value));
+                }
+
+                template <class U>
+                ResultNicheStorage(ErrTag, U&& error) noexcept {
+                    this->construct<!OkHosts>(std::forward<U>(error));
+                }
+
+                ResultNicheStorage(const ResultNicheStorage& other) noexcept
+                requires CopyableArms<V, E>
+                {
+                    this->construct_from(other);
+                }
+
+                ResultNicheStorage(ResultNicheStorage&& other) noexcept {
+                    this->construct_from(std::move(other));
+                }
+
+                ~ResultNicheStorage() noexcept {
+                    this->destroy();
+                }
+
+                auto operator=(const ResultNicheStorage& other) noexcept
+                    -> ResultNicheStorage&
+                requires CopyableArms<V, E>
+                {
+                    if (this != &other) [[likely]] {
+                        this->destroy();
+                        this->construct_from(other);
+                    }
+
+                    return *this;
+                }
+
+                auto operator=(ResultNicheStorage&& other) noexcept
+                    -> ResultNicheStorage& {
+
+                    if (this != &other) [[likely]] {
+                        this->destroy();
+                        this->construct_from(std::move(other));
+                    }
+
+                    return *this;
+                }
+
+                [[nodiscard]] auto is_ok() const noexcept -> bool {
+                    return this->is_host() == OkHosts;
+                }
+
+                template <class Self>
+                [[nodiscard]] auto ok(this Self&& self) noexcept
+                    -> decltype(auto) {
+                    return std::forward_like<Self>(
+                        *self.template get<OkHosts>());
+                }
+
+                template <class Self>
+                [[nodiscard]] auto err(this Self&& self) noexcept
+                    -> decltype(auto) {
+                    return std::forward_like<Self>(
+                        *self.template get<!OkHosts>());
+                }
+
+            private:
+                [[nodiscard]] auto is_host() const noexcept -> bool {
+
+                    auto word = std::uintptr_t{};
+                    std::memcpy(&word, _bytes + Niche::offset, sizeof(word));
+
+                    return word != Niche::none;
+                }
+
+                template <bool IsHost> auto get() noexcept {
+                    using A = std::conditional_t<IsHost, Host, Guest>;
+                    return std::launder(reinterpret_cast<A*>(
+                        _bytes + (IsHost ? 0 : guest_offset)));
+                }
+
+                template <bool IsHost> auto get() const noexcept {
+                    using A = std::conditional_t<IsHost, Host, Guest>;
+                    return std::launder(reinterpret_cast<const A*>(
+                        _bytes + (IsHost ? 0 : guest_offset)));
+                }
+
+                template <bool IsHost, class U>
+                auto construct(U&& value) noexcept -> void {
+                    using A = std::conditional_t<IsHost, Host, Guest>;
+
+                    if constexpr (!IsHost)
+                        std::memcpy(_bytes + Niche::offset, &Niche::none,
+                                    sizeof(Niche::none));
+
+                    std::construct_at(
+                        reinterpret_cast<A*>(
+                            _bytes + (IsHost ? 0 : guest_offset)),
+                        std::forward<U>(value));
+                }
+
+                template <class Other>
+                auto construct_from(Other&& other) noexcept -> void {
+                    if (other.is_host())
+                        this->construct<true>(std::forward_like<Other>(
+                            *other.template get<true>()));
+                    else
+                        this->construct<false>(std::forward_like<Other>(
+                            *other.template get<false>()));
+                }
+
+                auto destroy() noexcept -> void {
+                    if (this->is_host())
+                        std::destroy_at(this->get<true>());
+                    else
+                        std::destroy_at(this->get<false>());
+                }
+
+            private:
+                alignas(V) alignas(E) std::byte
+                    _bytes[std::max(sizeof(Host),
+                                    guest_offset + sizeof(Guest))];
+        };
+
+        /// Picks the smallest storage for the two arms.
+        template <class V, class E> consteval auto result_storage() noexcept {
+
+            using Tagged = ResultTaggedStorage<V, E>;
+            using ErrHosted = ResultNicheStorage<V, E, false>;
+            using OkHosted = ResultNicheStorage<V, E, true>;
+
+            if constexpr (lx::trait::Niche<E>) {
+                if constexpr (sizeof(ErrHosted) < sizeof(Tagged))
+                    return std::type_identity<ErrHosted>{};
+                else
+                    return std::type_identity<Tagged>{};
+            } else if constexpr (lx::trait::Niche<V>) {
+                if constexpr (sizeof(OkHosted) < sizeof(Tagged))
+                    return std::type_identity<OkHosted>{};
+                else
+                    return std::type_identity<Tagged>{};
+            } else {
+                return std::type_identity<Tagged>{};
+            }
+        }
+
+        template <class V, class E>
+        using ResultStorage = decltype(result_storage<V, E>())::type;
+
     }; // namespace impl
 
     using Empty = impl::Empty;
 
     /// Represents an Ok(value) success result.
     template <class T = void>
-    using Ok = impl::ResultTaggedValue<T, impl::OkTag>;
+    class Ok : public impl::ResultTaggedValue<T, impl::OkTag> {
+        public:
+            using impl::ResultTaggedValue<T, impl::OkTag>::ResultTaggedValue;
+    };
 
     /// Represents an Err(error) failure result.
     template <class E = void>
-    using Err = impl::ResultTaggedValue<E, impl::ErrTag>;
+    class Err : public impl::ResultTaggedValue<E, impl::ErrTag> {
+        public:
+            using impl::ResultTaggedValue<E, impl::ErrTag>::ResultTaggedValue;
+    };
+
+    template <class T> Ok(T) -> Ok<T>;
+    Ok() -> Ok<void>;
+
+    template <class E> Err(E) -> Err<E>;
+    Err() -> Err<void>;
+
+    /// Deduction guide to handle nested Ok(Ok(...)).
+    template <class U> Ok(Ok<U>) -> Ok<Ok<U>>;
+
+    /// Deduction guide to handle nested Err(Err(...)).
+    template <class U> Err(Err<U>) -> Err<Err<U>>;
+
+    /// Err("literal") keeps the literal instead of decaying it to a pointer.
+    template <usize N> Err(const char (&)[N]) -> Err<StaticStr>;
+
+    /// A writable buffer may change or go away, so Err(buffer) copies it.
+    template <usize N> Err(char (&)[N]) -> Err<std::string>;
 
     /**
      * @brief Generic Result type representing either success (Ok) or failure
@@ -115,26 +499,37 @@ namespace lx::core {
      *
      * A Result is either Ok(T) or Err(E), and provides helpers for safe
      * unwrapping, context propagation, and conditional conversions.
+     *
+     * Everything but context_fmt() is constexpr as long as both arms are
+     * literal types and no niche storage is picked. A panic during constant
+     * evaluation, e.g. unwrap() on Err, is a compile error.
      */
     template <class T, class E> class [[nodiscard]] Result {
         public:
             using Value = impl::VoidOrType<T>;
             using Error = impl::VoidOrType<E>;
-            using VariantType = std::variant<Value, Error>;
 
-            Result(Ok<Value> value) noexcept : _variant(*std::move(value)) {
+            /// Value and Error as forwarded out of a Self of that category.
+            template <class Self> using OkArm = impl::Forwarded<Self, Value>;
+            template <class Self> using ErrArm = impl::Forwarded<Self, Error>;
+
+            constexpr Result(Ok<Value> value) noexcept
+                : _storage(impl::OkTag{}, *std::move(value)) {
             }
-            Result(Err<Error> error) noexcept : _variant(*std::move(error)) {
+            constexpr Result(Err<Error> error) noexcept
+                : _storage(impl::ErrTag{}, *std::move(error)) {
             }
 
             template <class U = void>
             requires std::same_as<T, void>
-            Result(Ok<void>) noexcept : _variant(Value{}) {
+            constexpr Result(Ok<void>) noexcept
+                : _storage(impl::OkTag{}, Value{}) {
             }
 
             template <class F = void>
             requires std::same_as<E, void>
-            Result(Err<void>) noexcept : _variant(Error{}) {
+            constexpr Result(Err<void>) noexcept
+                : _storage(impl::ErrTag{}, Error{}) {
             }
 
             /**
@@ -143,7 +538,8 @@ namespace lx::core {
              */
             template <class U>
             requires(!lx::trait::From<U, T> && std::convertible_to<U, Value>)
-            Result(Ok<U> value) noexcept : _variant(*std::move(value)) {
+            constexpr Result(Ok<U> value) noexcept
+                : _storage(impl::OkTag{}, *std::move(value)) {
             }
 
             /**
@@ -152,85 +548,157 @@ namespace lx::core {
              */
             template <class F>
             requires(!lx::trait::From<F, E> && std::convertible_to<F, Error>)
-            Result(Err<F> error) noexcept : _variant(*std::move(error)) {
+            constexpr Result(Err<F> error) noexcept
+                : _storage(impl::ErrTag{}, *std::move(error)) {
             }
 
             /// Construct from Ok<U> using trait-based conversion.
             template <class U>
             requires lx::trait::From<U, T>
-            Result(Ok<U> value) noexcept
-                : _variant(lx::trait::FromImpl<U, T>::from(*std::move(value))) {
+            constexpr Result(Ok<U> value) noexcept
+                : _storage(impl::OkTag{},
+                           lx::trait::FromImpl<U, T>::from(*std::move(value))) {
             }
 
             /// Construct from Err<F> using trait-based conversion.
             template <class F>
             requires lx::trait::From<F, E>
-            Result(Err<F> error) noexcept
-                : _variant(lx::trait::FromImpl<F, E>::from(*std::move(error))) {
+            constexpr Result(Err<F> error) noexcept
+                : _storage(impl::ErrTag{},
+                           lx::trait::FromImpl<F, E>::from(*std::move(error))) {
             }
 
-            auto operator==(const Result& other) const noexcept -> bool {
-                return _variant == other._variant;
+            constexpr auto operator==(const Result& other) const noexcept
+                -> bool {
+
+                if (this->is_ok() != other.is_ok()) return false;
+
+                if (this->is_ok()) return _storage.ok() == other._storage.ok();
+
+                return _storage.err() == other._storage.err();
             }
 
+            /// Adds a literal context message to the error, if there is one.
             template <class U = void>
             requires impl::WithContext<Error>
-            [[nodiscard]] auto context(std::string_view msg) & noexcept
-                -> Result<Value, Error>& {
-
-                if (this->is_err()) {
-                    auto& e = this->unwrap_err();
-                    e = e.context(msg);
-                }
-
+            [[nodiscard]] constexpr auto context(StaticStr msg) & noexcept
+                -> Result& {
+                this->add_context(msg);
                 return *this;
             }
 
             template <class U = void>
             requires impl::WithContext<Error>
-            [[nodiscard]] auto context(std::string_view msg) && noexcept
-                -> Result<Value, Error>&& {
+            [[nodiscard]] constexpr auto context(StaticStr msg) && noexcept
+                -> Result&& {
+                this->add_context(msg);
+                return std::move(*this);
+            }
+
+            /// Adds a runtime context message to the error, if there is one.
+            template <class M>
+            requires impl::WithContext<Error> &&
+                     (!impl::StringLiteral<M>) &&
+                     std::convertible_to<M, std::string_view>
+            [[nodiscard]] constexpr auto context(M&& msg) & noexcept
+                -> Result& {
+                this->add_context(std::string_view(msg));
+                return *this;
+            }
+
+            template <class M>
+            requires impl::WithContext<Error> &&
+                     (!impl::StringLiteral<M>) &&
+                     std::convertible_to<M, std::string_view>
+            [[nodiscard]] constexpr auto context(M&& msg) && noexcept
+                -> Result&& {
+                this->add_context(std::string_view(msg));
+                return std::move(*this);
+            }
+
+            /**
+             * @brief Adds the message returned by f to the error, if there is
+             * one. f only runs on the error path, so it may format or
+             * allocate without slowing down Ok results.
+             */
+            template <class F>
+            requires impl::ContextFn<F, Error>
+            [[nodiscard]] constexpr auto with_context(F&& f) & noexcept(
+                std::is_nothrow_invocable_v<F>) -> Result& {
+                if (this->is_err()) [[unlikely]]
+                    this->add_context(std::invoke(std::forward<F>(f)));
+                return *this;
+            }
 
-                if (this->is_err()) {
-                    auto& e = this->unwrap_err();
-                    e = e.context(msg);
+            template <class F>
+            requires impl::ContextFn<F, Error>
+            [[nodiscard]] constexpr auto with_context(F&& f) && noexcept(
+                std::is_nothrow_invocable_v<F>) -> Result&& {
+                if (this->is_err()) [[unlikely]]
+                    this->add_context(std::invoke(std::forward<F>(f)));
+                return std::move(*this);
+            }
+
+            /**
+             * @brief Adds std::format(fmt, args...) to the error, if there is
+             * one. The arguments are taken by reference and only formatted
+             * on the error path.
+             */
+            template <class... Args>
+            requires impl::WithContextFmt<Error, Args...>
+            [[nodiscard]] auto context_fmt(std::format_string<Args...> fmt,
+                                           Args&&... args) & noexcept
+                -> Result& {
+                if (this->is_err()) [[unlikely]] {
+                    auto& e = _storage.err();
+                    e = e.context_fmt(fmt, std::forward<Args>(args)...);
                 }
+                return *this;
+            }
 
+            template <class... Args>
+            requires impl::WithContextFmt<Error, Args...>
+            [[nodiscard]] auto context_fmt(std::format_string<Args...> fmt,
+                                           Args&&... args) && noexcept
+                -> Result&& {
+                if (this->is_err()) [[unlikely]] {
+                    auto& e = _storage.err();
+                    e = e.context_fmt(fmt, std::forward<Args>(args)...);
+                }
                 return std::move(*this);
             }
 
             /// @brief Returns true if the Result contains Ok(value).
-            [[nodiscard]] auto is_ok() const noexcept -> bool {
-                return std::holds_alternative<Value>(_variant);
+            [[nodiscard]] constexpr auto is_ok() const noexcept -> bool {
+                return _storage.is_ok();
             }
 
             /// @brief Returns true if the Result contains Err(error).
-            [[nodiscard]] auto is_err() const noexcept -> bool {
-                return std::holds_alternative<Error>(_variant);
+            [[nodiscard]] constexpr auto is_err() const noexcept -> bool {
+                return !_storage.is_ok();
             }
 
-            [[nodiscard]] auto ok() const& noexcept -> Option<Value> {
-                if (auto* p = std::get_if<Value>(&_variant)) return Some(*p);
+            [[nodiscard]] constexpr auto ok() const& noexcept -> Option<Value> {
+                if (this->is_ok()) return Some(_storage.ok());
 
                 return None;
             }
 
-            [[nodiscard]] auto ok() && noexcept -> Option<Value> {
-                if (auto* p = std::get_if<Value>(&_variant))
-                    return Some(std::move(*p));
+            [[nodiscard]] constexpr auto ok() && noexcept -> Option<Value> {
+                if (this->is_ok()) return Some(std::move(_storage).ok());
 
                 return None;
             }
 
-            [[nodiscard]] auto err() const& noexcept -> Option<Error> {
-                if (auto* p = std::get_if<Error>(&_variant)) return Some(*p);
+            [[nodiscard]] constexpr auto err() const& noexcept
+                -> Option<Error> {
+                if (this->is_err()) return Some(_storage.err());
 
                 return None;
             }
 
-            [[nodiscard]] auto err() && noexcept -> Option<Error> {
-                if (auto* p = std::get_if<Error>(&_variant))
-                    return Some(std::move(*p));
+            [[nodiscard]] constexpr auto err() && noexcept -> Option<Error> {
+                if (this->is_err()) return Some(std::move(_storage).err());
 
                 return None;
             }
@@ -240,7 +708,7 @@ namespace lx::core {
              * @param loc Source location for diagnostics.
              */
             template <class Self>
-            auto unwrap(this Self&& self,
+            constexpr auto unwrap(this Self&& self,
                         std::source_location loc =
                             std::source_location::current()) noexcept
                 -> decltype(auto) {
@@ -252,21 +720,21 @@ namespace lx::core {
              * @brief Unwraps the Ok value with custom panic message.
              */
             template <class Self>
-            auto expect(this Self&& self, std::string_view msg,
+            constexpr auto expect(this Self&& self, std::string_view msg,
                         std::source_location loc =
                             std::source_location::current()) noexcept
                 -> decltype(auto) {
-                if (auto* p = std::get_if<Value>(&self._variant))
-                    return std::forward_like<Self>(*p);
+                if (!self._storage.is_ok()) [[unlikely]]
+                    panic(msg, loc);
 
-                panic(msg, loc);
+                return std::forward<Self>(self)._storage.ok();
             }
 
             /**
              * @brief Unwraps the Err value or panics if Ok.
              */
             template <class Self>
-            auto unwrap_err(this Self&& self,
+            constexpr auto unwrap_err(this Self&& self,
                             std::source_location loc =
                                 std::source_location::current()) noexcept
                 -> decltype(auto) {
@@ -278,27 +746,234 @@ namespace lx::core {
              * @brief Unwraps the Err value with custom panic message.
              */
             template <class Self>
-            auto expect_err(this Self&& self, std::string_view msg,
+            constexpr auto expect_err(this Self&& self, std::string_view msg,
                             std::source_location loc =
                                 std::source_location::current()) noexcept
                 -> decltype(auto) {
-                if (auto* p = std::get_if<Error>(&self._variant)) {
-                    return std::forward_like<Self>(*p);
-                };
+                if (self._storage.is_ok()) [[unlikely]]
+                    panic(msg, loc);
+
+                return std::forward<Self>(self)._storage.err();
+            }
+
+            /// Unwraps the Ok value without checking that there is one.
+            template <class Self>
+            constexpr auto unsafe_unwrap(this Self&& self) noexcept
+                -> decltype(auto) {
+                return std::forward<Self>(self)._storage.ok();
+            }
+
+            /// Unwraps the Err value without checking that there is one.
+            template <class Self>
+            constexpr auto unsafe_unwrap_err(this Self&& self) noexcept
+                -> decltype(auto) {
+                return std::forward<Self>(self)._storage.err();
+            }
+
+            /**
+             * @brief Calls on_ok with the Ok value or on_err with the Err
+             * value, forwarding the Result's value category.
+             * @return Whatever the called function returns.
+             */
+            template <class Self, class OnOk, class OnErr>
+            constexpr auto match(this Self&& self, OnOk&& on_ok,
+                                 OnErr&& on_err) noexcept
+                -> decltype(auto) {
+
+                if (self._storage.is_ok())
+                    return std::forward<OnOk>(on_ok)(
+                        std::forward<Self>(self)._storage.ok());
+
+                return std::forward<OnErr>(on_err)(
+                    std::forward<Self>(self)._storage.err());
+            }
+
+            /// Returns the Ok value, or `fallback` for an Err.
+            template <class Self>
+            constexpr auto unwrap_or(this Self&& self, Value fallback) noexcept
+                -> Value {
+
+                if (self.is_ok()) return std::forward<Self>(self)._storage.ok();
+
+                return fallback;
+            }
+
+            /// Returns the Ok value, or what `f(error)` returns for an Err.
+            template <class Self, class F>
+            constexpr auto unwrap_or_else(this Self&& self, F&& f) noexcept(
+                impl::NothrowArm<E, F, ErrArm<Self>>) -> Value {
 
-                panic(msg, loc);
+                if (self.is_ok()) return std::forward<Self>(self)._storage.ok();
+
+                return impl::invoke_arm<E>(
+                    std::forward<F>(f),
+                    std::forward<Self>(self)._storage.err());
             }
 
             /**
-             * @brief Returns reference to the underlying std::variant.
+             * @brief Ok(f(value)) or the same Err. The value is forwarded
+             * with the Result's value category, never copied on the way.
              */
+            template <class Self, class F>
+            constexpr auto map(this Self&& self, F&& f) noexcept(
+                impl::NothrowArm<T, F, OkArm<Self>>)
+                -> Result<impl::ArmResult<T, F, OkArm<Self>>, E> {
+
+                using U = impl::ArmResult<T, F, OkArm<Self>>;
+
+                if (self.is_err())
+                    return Err<Error>(std::forward<Self>(self)._storage.err());
+
+                if constexpr (std::is_void_v<U>) {
+                    impl::invoke_arm<T>(std::forward<F>(f),
+                                        std::forward<Self>(self)._storage.ok());
+                    return Ok();
+                } else {
+                    return Ok<U>(impl::invoke_arm<T>(
+                        std::forward<F>(f),
+                        std::forward<Self>(self)._storage.ok()));
+                }
+            }
+
+            /// The same Ok, or Err(f(error)).
+            template <class Self, class F>
+            constexpr auto map_err(this Self&& self, F&& f) noexcept(
+                impl::NothrowArm<E, F, ErrArm<Self>>)
+                -> Result<T, impl::ArmResult<E, F, ErrArm<Self>>> {
+
+                using G = impl::ArmResult<E, F, ErrArm<Self>>;
+
+                if (self.is_ok())
+                    return Ok<Value>(std::forward<Self>(self)._storage.ok());
+
+                if constexpr (std::is_void_v<G>) {
+                    impl::invoke_arm<E>(
+                        std::forward<F>(f),
+                        std::forward<Self>(self)._storage.err());
+                    return Err();
+                } else {
+                    return Err<G>(impl::invoke_arm<E>(
+                        std::forward<F>(f),
+                        std::forward<Self>(self)._storage.err()));
+                }
+            }
+
+            /// f(value), which returns a Result itself, or the same Err.
+            template <class Self, class F>
+            requires impl::IsResult<impl::ArmResult<T, F, OkArm<Self>>>
+            constexpr auto and_then(this Self&& self, F&& f) noexcept(
+                impl::NothrowArm<T, F, OkArm<Self>>)
+                -> impl::ArmResult<T, F, OkArm<Self>> {
+
+                if (self.is_err())
+                    return Err<Error>(std::forward<Self>(self)._storage.err());
+
+                return impl::invoke_arm<T>(
+                    std::forward<F>(f), std::forward<Self>(self)._storage.ok());
+            }
+
+            /// The same Ok, or f(error), which returns a Result itself.
+            template <class Self, class F>
+            requires impl::IsResult<impl::ArmResult<E, F, ErrArm<Self>>>
+            constexpr auto or_else(this Self&& self, F&& f) noexcept(
+                impl::NothrowArm<E, F, ErrArm<Self>>)
+                -> impl::ArmResult<E, F, ErrArm<Self>> {
+
+                if (self.is_ok())
+                    return Ok<Value>(std::forward<Self>(self)._storage.ok());
+
+                return impl::invoke_arm<E>(
+                    std::forward<F>(f),
+                    std::forward<Self>(self)._storage.err());
+            }
+
+            /// Calls f with a const reference to the Ok value, if any.
+            template <class Self, class F>
+            constexpr auto inspect(this Self&& self, F&& f) noexcept(
+                impl::NothrowArm<T, F, const Value&>) -> Self {
+
+                if (self.is_ok())
+                    impl::invoke_arm<T>(std::forward<F>(f),
+                                        std::as_const(self._storage.ok()));
+
+                return std::forward<Self>(self);
+            }
+
+            /// Calls f with a const reference to the Err value, if any.
+            template <class Self, class F>
+            constexpr auto inspect_err(this Self&& self, F&& f) noexcept(
+                impl::NothrowArm<E, F, const Error&>) -> Self {
+
+                if (self.is_err())
+                    impl::invoke_arm<E>(std::forward<F>(f),
+                                        std::as_const(self._storage.err()));
+
+                return std::forward<Self>(self);
+            }
+
+            /// Result<Result<U, E>, E> to Result<U, E>.
+            template <class Self>
+            requires impl::IsResult<Value>
+            constexpr auto flatten(this Self&& self) noexcept -> Value {
+
+                if (self.is_err())
+                    return Err<Error>(std::forward<Self>(self)._storage.err());
+
+                return std::forward<Self>(self)._storage.ok();
+            }
+
+            /// Result<Option<U>, E> to Option<Result<U, E>>.
             template <class Self>
-            auto get_variant(this Self&& self) noexcept -> decltype(auto) {
-                return std::forward_like<Self>(self._variant);
+            requires impl::IsOption<Value>
+            constexpr auto transpose(this Self&& self) noexcept -> Option<
+                Result<typename std::remove_cvref_t<OkArm<Self>>::Value, E>> {
+
+                using U = typename Value::Value;
+
+                if (self.is_err())
+                    return Some(Result<U, E>(
+                        Err<Error>(std::forward<Self>(self)._storage.err())));
+
+                auto&& inner = std::forward<Self>(self)._storage.ok();
+                if (inner.is_none()) return None;
+
+                return Some(Result<U, E>(
+                    Ok<U>(std::forward<decltype(inner)>(inner).unwrap())));
             }
 
         private:
-            VariantType _variant;
+            template <class M> auto add_context(M&& msg) noexcept -> void {
+                if (this->is_err()) [[unlikely]] {
+                    auto& e = _storage.err();
+                    e = e.context(std::forward<M>(msg));
+                }
+            }
+
+        private:
+            impl::ResultStorage<Value, Error> _storage;
     };
 
+    namespace impl {
+
+        template <class T, class E> struct OptionTranspose<Result<T, E>> {
+                template <class O>
+                static constexpr auto apply(O&& option) noexcept
+                    -> Result<Option<T>, E> {
+
+                    if (option.is_none()) return Ok(Option<T>(None));
+
+                    auto&& result = std::forward<O>(option).unwrap();
+                    using Forward = decltype(result);
+
+                    if (result.is_err())
+                        return Err<typename Result<T, E>::Error>(
+                            std::forward<Forward>(result).unwrap_err());
+
+                    return Ok(Option<T>(
+                        Some<T>(std::forward<Forward>(result).unwrap())));
+                }
+        };
+
+    }; // namespace impl
+
 }; // namespace lx::core
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "lastix/core/number.hpp"
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace lx::core {
+
+    /**
+     * @brief View of a string literal.
+     *
+     * The constructor is consteval, so only arrays usable in constant
+     * expressions are accepted: string literals and constexpr arrays, all of
+     * which have static storage. A StaticStr can therefore be kept for as
+     * long as needed without copying the characters.
+     *
+     * Borrowing happens nowhere else. Writable char buffers never match
+     * StringLiteral and are copied by Error, Err and context(); a const
+     * array on the stack is not a constant expression, so building a
+     * StaticStr from it fails to compile instead of dangling.
+     */
+    class StaticStr {
+
+        public:
+            template <usize N>
+            consteval StaticStr(const char (&literal)[N]) noexcept
+                : _data(literal), _size(N - 1) {
+            }
+
+            [[nodiscard]] constexpr auto view() const noexcept
+                -> std::string_view {
+                return {_data, _size};
+            }
+
+            constexpr operator std::string_view() const noexcept {
+                return this->view();
+            }
+
+            /// Lets Err("literal") still convert to Result<T, std::string>.
+            constexpr operator std::string() const {
+                return std::string(this->view());
+            }
+
+        private:
+            const char* _data;
+            usize _size;
+    };
+
+    namespace impl {
+
+        /// Matches const char arrays, the type of a string literal argument.
+        template <class T>
+        concept StringLiteral =
+            std::is_bounded_array_v<std::remove_reference_t<T>> &&
+            std::is_same_v<std::remove_extent_t<std::remove_reference_t<T>>,
+                           const char>;
+
+    }; // namespace impl
+
+}; // namespace lx::core
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "lastix/trait/send.hpp"
+
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace lx::core {
+
+    /**
+     * @brief Starts a std::jthread running f(args...).
+     *
+     * The callable and every argument are moved to the new thread, so each of
+     * them has to be lx::trait::Send. Pass state as arguments rather than
+     * lambda captures: C++ cannot look inside a closure, so a captured
+     * non-Send handle (e.g. Rc) is only rejected when it is an argument.
+     */
+    template <class F, class... Args>
+    requires(lx::trait::Send<std::decay_t<F>> &&
+             (lx::trait::Send<std::decay_t<Args>> && ...))
+    [[nodiscard]] auto spawn(F&& f, Args&&... args) -> std::jthread {
+        return std::jthread(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+}; // namespace lx::core
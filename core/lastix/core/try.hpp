@@ -0,0 +1,104 @@
+#pragma once
+
+#include "lastix/core/option.hpp"
+#include "lastix/core/result.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace lx::core::impl {
+
+    /**
+     * @brief What LX_TRY needs to know about a type: whether a value is a
+     * failure, what to return from the enclosing function in that case, and
+     * how to get the success value out.
+     */
+    template <class T> struct TryImpl;
+
+    template <class T, class E> struct TryImpl<Result<T, E>> {
+
+            static auto failed(const Result<T, E>& result) noexcept -> bool {
+                return result.is_err();
+            }
+
+            /// Err(error), which the caller's Result converts through From.
+            template <class R>
+            [[gnu::cold]] static auto residual(R&& result) noexcept {
+                return Err<typename Result<T, E>::Error>(
+                    std::forward<R>(result).unsafe_unwrap_err());
+            }
+
+            template <class R>
+            static auto output(R&& result) noexcept -> decltype(auto) {
+                return std::forward<R>(result).unsafe_unwrap();
+            }
+    };
+
+    template <class T> struct TryImpl<Option<T>> {
+
+            static auto failed(const Option<T>& option) noexcept -> bool {
+                return option.is_none();
+            }
+
+            template <class O>
+            [[gnu::cold]] static auto residual(O&&) noexcept -> NoneType {
+                return None;
+            }
+
+            template <class O>
+            static auto output(O&& option) noexcept -> decltype(auto) {
+                return std::forward<O>(option).unsafe_unwrap();
+            }
+    };
+
+    template <class T> using TryFor = TryImpl<std::remove_cvref_t<T>>;
+
+}; // namespace lx::core::impl
+
+/**
+ * @brief Evaluates to the Ok value of a Result (or the value of an Option),
+ * or returns the Err (or None) from the enclosing function.
+ *
+ *     auto header = LX_TRY(parse_header(input));
+ *
+ * The expression must be an rvalue, as the value or the error is moved out
+ * of it: pass a named Result or Option through std::move(). Copying an
+ * lvalue instead would not compile for move-only errors. The error goes
+ * through the Err constructors of the function's Result, so From
+ * conversions apply. The error branch is [[unlikely]] and leaves through a
+ * cold function, which keeps it out of the hot path. Uses a GNU statement
+ * expression; __extension__ keeps -pedantic quiet about it.
+ */
+#define LX_TRY(...)                                                            \
+    __extension__({                                                            \
+        auto&& lx_try_value = (__VA_ARGS__);                                   \
+        static_assert(                                                         \
+            !::std::is_lvalue_reference_v<decltype(lx_try_value)>,             \
+            "LX_TRY needs an rvalue; std::move() a named value");              \
+        using LxTry = ::lx::core::impl::TryFor<decltype(lx_try_value)>;        \
+        if (LxTry::failed(lx_try_value)) [[unlikely]]                          \
+            return LxTry::residual(                                            \
+                ::std::forward<decltype(lx_try_value)>(lx_try_value));         \
+        LxTry::output(::std::forward<decltype(lx_try_value)>(lx_try_value));   \
+    })
+
+/**
+ * @brief LX_TRY that adds a context message to the error before returning
+ * it. The message arguments are only evaluated on the error path, so they
+ * may format. The expression must be an rvalue, as for LX_TRY:
+ *
+ *     auto n = LX_TRY_CONTEXT(parse_int(field), std::format("field {}", i));
+ */
+#define LX_TRY_CONTEXT(expr, ...)                                              \
+    __extension__({                                                            \
+        auto&& lx_try_value = (expr);                                          \
+        static_assert(                                                         \
+            !::std::is_lvalue_reference_v<decltype(lx_try_value)>,             \
+            "LX_TRY needs an rvalue; std::move() a named value");              \
+        using LxTry = ::lx::core::impl::TryFor<decltype(lx_try_value)>;        \
+        if (LxTry::failed(lx_try_value)) [[unlikely]]                          \
+            return LxTry::residual(                                            \
+                ::std::forward<decltype(lx_try_value)>(lx_try_value)           \
+                    .context(__VA_ARGS__));                                    \
+        LxTry::output(::std::forward<decltype(lx_try_value)>(lx_try_value));   \
+    })
@@ -0,0 +1,529 @@
+#pragma once
+
+#include "lastix/core/box.hpp"
+#include "lastix/core/diagnostics.hpp"
+#include "lastix/core/error.hpp"
+#include "lastix/core/memory.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/core/result.hpp"
+#include "lastix/trait/niche.hpp"
+#include "lastix/trait/relocatable.hpp"
+#include "lastix/trait/send.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace lx::core {
+
+    namespace impl {
+
+        /// An allocator that can resize a block, like SystemAllocator.
+        template <class A, class T>
+        concept Reallocating = requires(A alloc, T* ptr, usize n) {
+            { alloc.reallocate(ptr, n, n) } -> std::same_as<T*>;
+        };
+
+        /**
+         * @brief Moves n objects from `from` to the uninitialized `to` and
+         * ends their lifetime at `from`. The ranges may overlap.
+         */
+        template <class T>
+        auto relocate(T* from, usize n, T* to) noexcept -> void {
+
+            if (n == 0 || from == to) return;
+
+            if constexpr (lx::trait::TriviallyRelocatable<T>) {
+                std::memmove(static_cast<void*>(to),
+                             static_cast<const void*>(from), n * sizeof(T));
+            } else if (std::less<T*>()(to, from)) {
+                for (auto i = usize{0}; i < n; i++) {
+                    std::construct_at(to + i, std::move(from[i]));
+                    std::destroy_at(from + i);
+                }
+            } else {
+                for (auto i = n; i > 0; i--) {
+                    std::construct_at(to + i - 1, std::move(from[i - 1]));
+                    std::destroy_at(from + i - 1);
+                }
+            }
+        }
+
+    }; // namespace impl
+
+    template <class T, class Alloc> class Vec;
+
+    /**
+     * @brief Elements taken out of a Vec by Vec::drain(). next() moves them
+     * out one by one; dropping the Drain destroys the ones not taken and
+     * slides the tail of the Vec down over the gap.
+     *
+     * The drained range and the tail still hold live elements until the
+     * Drain is dropped, so the Vec must not be changed while it lives:
+     * pushing, inserting, reserving or clearing would build over them or
+     * move them away. Only the elements before the range may be read.
+     */
+    template <class T, class Alloc> class Drain {
+
+        public:
+            Drain(const Drain&) = delete;
+            auto operator=(const Drain&) -> Drain& = delete;
+
+            ~Drain() noexcept {
+                auto* data = _vec->_ptr;
+
+                std::destroy(data + _next, data + _end);
+                impl::relocate(data + _end, _tail, data + _vec->_len);
+
+                _vec->_len += _tail;
+            }
+
+            /// The next element of the range, moved out of the Vec.
+            [[nodiscard]] auto next() noexcept -> Option<T> {
+
+                if (_next == _end) return None;
+
+                auto* element = _vec->_ptr + _next++;
+                auto value = Option<T>(Some(std::move(*element)));
+                std::destroy_at(element);
+
+                return value;
+            }
+
+            /// Elements not taken yet.
+            [[nodiscard]] auto len() const noexcept -> usize {
+                return _end - _next;
+            }
+
+        private:
+            friend class Vec<T, Alloc>;
+
+            Drain(Vec<T, Alloc>& vec, usize from, usize to) noexcept
+                : _vec(&vec), _next(from), _end(to), _tail(vec._len - to) {
+                vec._len = from;
+            }
+
+        private:
+            Vec<T, Alloc>* _vec;
+            usize _next;
+            usize _end;
+
+            /// Elements after the range, which start at _end.
+            usize _tail;
+    };
+
+    /**
+     * @brief Growable array that owns its elements.
+     *
+     * Nothing throws: try_push() and try_reserve() return growth failures
+     * as an Error, and the other growing calls panic on them. An allocator
+     * reports running out of memory by returning nullptr, as the default
+     * SystemAllocator does; std::allocator aborts instead.
+     *
+     * Trivially relocatable elements (lx::trait::TriviallyRelocatable,
+     * which includes Box, Arc and Rc) are moved with memcpy and memmove
+     * instead of a move and a destructor call each, and with realloc() when
+     * the allocator has reallocate().
+     */
+    template <class T, class Alloc = SystemAllocator<T>> class Vec {
+
+        public:
+            using Allocator = typename std::allocator_traits<
+                Alloc>::template rebind_alloc<T>;
+
+            Vec() noexcept = default;
+
+            explicit Vec(const Alloc& alloc) noexcept : _alloc(alloc) {
+            }
+
+            /// Room for `capacity` elements up front; panics if it fails.
+            [[nodiscard]] static auto with_capacity(usize capacity,
+                                                    const Alloc& alloc = {})
+                noexcept -> Vec {
+
+                auto vec = Vec(alloc);
+                vec.reserve(capacity);
+
+                return vec;
+            }
+
+            Vec(Vec&& other) noexcept
+                : _ptr(std::exchange(other._ptr, nullptr)),
+                  _len(std::exchange(other._len, 0)),
+                  _capacity(std::exchange(other._capacity, 0)),
+                  _alloc(std::move(other._alloc)) {
+            }
+
+            auto operator=(Vec&& other) noexcept -> Vec& {
+
+                if (this != &other) [[likely]] {
+                    this->reset();
+                    _ptr = std::exchange(other._ptr, nullptr);
+                    _len = std::exchange(other._len, 0);
+                    _capacity = std::exchange(other._capacity, 0);
+                    _alloc = std::move(other._alloc);
+                }
+
+                return *this;
+            }
+
+            ~Vec() noexcept {
+                this->reset();
+            }
+
+            Vec(const Vec&) = delete;
+            auto operator=(const Vec&) -> Vec& = delete;
+
+            [[nodiscard]] auto len() const noexcept -> usize {
+                return _len;
+            }
+
+            [[nodiscard]] auto capacity() const noexcept -> usize {
+                return _capacity;
+            }
+
+            [[nodiscard]] auto is_empty() const noexcept -> bool {
+                return _len == 0;
+            }
+
+            [[nodiscard]] auto operator[](usize i) noexcept -> T& {
+
+                if (i >= _len) [[unlikely]]
+                    panic("Vec index out of bounds");
+
+                return _ptr[i];
+            }
+
+            [[nodiscard]] auto operator[](usize i) const noexcept
+                -> const T& {
+
+                if (i >= _len) [[unlikely]]
+                    panic("Vec index out of bounds");
+
+                return _ptr[i];
+            }
+
+            [[nodiscard]] auto as_span() noexcept -> std::span<T> {
+                return {_ptr, _len};
+            }
+
+            [[nodiscard]] auto as_span() const noexcept -> std::span<const T> {
+                return {_ptr, _len};
+            }
+
+            operator std::span<T>() & noexcept {
+                return this->as_span();
+            }
+
+            operator std::span<const T>() const& noexcept {
+                return this->as_span();
+            }
+
+            [[nodiscard]] auto begin() noexcept -> T* {
+                return _ptr;
+            }
+
+            [[nodiscard]] auto begin() const noexcept -> const T* {
+                return _ptr;
+            }
+
+            [[nodiscard]] auto end() noexcept -> T* {
+                return _ptr + _len;
+            }
+
+            [[nodiscard]] auto end() const noexcept -> const T* {
+                return _ptr + _len;
+            }
+
+            /// Appends value, growing if needed; panics if growing fails.
+            auto push(T value) noexcept -> void {
+
+                if (_len == _capacity) [[unlikely]]
+                    this->reserve(1);
+
+                std::construct_at(_ptr + _len, std::move(value));
+                _len++;
+            }
+
+            /// Appends value, or drops it and returns why growing failed.
+            [[nodiscard]] auto try_push(T value) noexcept
+                -> Result<void, Error> {
+
+                if (_len == _capacity) [[unlikely]] {
+                    auto grown = this->grow(1);
+                    if (grown.is_err()) return grown;
+                }
+
+                std::construct_at(_ptr + _len, std::move(value));
+                _len++;
+
+                return Ok();
+            }
+
+            /// Moves the last element out, if any.
+            auto pop() noexcept -> Option<T> {
+
+                if (_len == 0) return None;
+
+                _len--;
+                auto value = Option<T>(Some(std::move(_ptr[_len])));
+                std::destroy_at(_ptr + _len);
+
+                return value;
+            }
+
+            /// Makes room for `additional` more elements; panics if it fails.
+            auto reserve(usize additional) noexcept -> void {
+
+                if (_capacity - _len >= additional) [[likely]]
+                    return;
+
+                auto grown = this->grow(additional);
+                if (grown.is_err()) [[unlikely]]
+                    panic(grown.unwrap_err().what());
+            }
+
+            /**
+             * @brief Makes room for `additional` more elements, or returns
+             * an Error if the capacity would overflow or the allocator is out
+             * of memory. The Vec is unchanged on failure.
+             */
+            [[nodiscard]] auto try_reserve(usize additional) noexcept
+                -> Result<void, Error> {
+
+                if (_capacity - _len >= additional) [[likely]]
+                    return Ok();
+
+                return this->grow(additional);
+            }
+
+            /// Gives back unused capacity, if the allocator can.
+            auto shrink_to_fit() noexcept -> void {
+
+                if (_capacity == _len) return;
+
+                if (_len == 0) {
+                    this->free_storage();
+                    _ptr = nullptr;
+                    _capacity = 0;
+                    return;
+                }
+
+                // Keeping the larger block is fine when this fails
+                static_cast<void>(this->resize_storage(_len));
+            }
+
+            /// Appends copies of values, growing at most once.
+            auto extend_from_slice(std::span<const T> values) noexcept -> void
+            requires std::copy_constructible<T>
+            {
+                // values may be part of this Vec, which reserve() can move
+                auto* source = values.data();
+                auto inside =
+                    std::less_equal<const T*>()(_ptr, source) &&
+                    std::less<const T*>()(source, _ptr + _len);
+                auto offset = inside ? source - _ptr : 0;
+
+                this->reserve(values.size());
+                if (inside) source = _ptr + offset;
+
+                if constexpr (std::is_trivially_copyable_v<T>) {
+                    if (!values.empty())
+                        std::memcpy(_ptr + _len, source,
+                                    values.size() * sizeof(T));
+                } else {
+                    std::uninitialized_copy_n(source, values.size(),
+                                              _ptr + _len);
+                }
+
+                _len += values.size();
+            }
+
+            /**
+             * @brief Removes the elements in [from, to) and hands them out
+             * through the returned Drain; the rest of the Vec closes the gap
+             * once the Drain is dropped. Panics if the range is out of
+             * bounds. The Vec must not be changed until the Drain is gone.
+             */
+            [[nodiscard]] auto drain(usize from, usize to) noexcept
+                -> Drain<T, Alloc> {
+
+                if (from > to || to > _len) [[unlikely]]
+                    panic("Vec drain range out of bounds");
+
+                return Drain<T, Alloc>(*this, from, to);
+            }
+
+            /**
+             * @brief Keeps the elements for which keep(element) is true, in
+             * their order. Runs of kept elements are moved down together.
+             */
+            template <class F>
+            requires std::predicate<F&, T&>
+            auto retain(F&& keep) noexcept(std::is_nothrow_invocable_v<F&, T&>)
+                -> void {
+
+                auto kept = usize{0};
+                auto run = usize{0};
+
+                for (auto i = usize{0}; i < _len; i++) {
+                    if (std::invoke(keep, _ptr[i])) continue;
+
+                    impl::relocate(_ptr + run, i - run, _ptr + kept);
+                    kept += i - run;
+
+                    std::destroy_at(_ptr + i);
+                    run = i + 1;
+                }
+
+                impl::relocate(_ptr + run, _len - run, _ptr + kept);
+                _len = kept + (_len - run);
+            }
+
+            /// Destroys the elements from `len` on; keeps the capacity.
+            auto truncate(usize len) noexcept -> void {
+
+                if (len >= _len) return;
+
+                std::destroy(_ptr + len, _ptr + _len);
+                _len = len;
+            }
+
+            /// Destroys every element; keeps the capacity.
+            auto clear() noexcept -> void {
+                this->truncate(0);
+            }
+
+            /**
+             * @brief Hands the elements to a Box<T[]> without moving them.
+             * The Box keeps the whole block, which its deleter frees.
+             */
+            [[nodiscard]] auto into_boxed_slice() && noexcept
+                -> Box<T[], AllocatorSliceDeleter<T, Alloc>> {
+
+                using Deleter = AllocatorSliceDeleter<T, Alloc>;
+
+                auto deleter = Deleter{std::move(_alloc), _len, _capacity};
+                auto len = std::exchange(_len, 0);
+                _capacity = 0;
+
+                return Box<T[], Deleter>::unsafe_from_raw(
+                    std::exchange(_ptr, nullptr), len, std::move(deleter));
+            }
+
+            auto unsafe_get() & noexcept -> T* {
+                return _ptr;
+            }
+
+            auto unsafe_get() const& noexcept -> const T* {
+                return _ptr;
+            }
+
+        private:
+            friend class Drain<T, Alloc>;
+
+            using Traits = std::allocator_traits<Allocator>;
+
+            /// Largest capacity whose size in bytes fits in a ptrdiff_t.
+            static constexpr auto max_capacity =
+                static_cast<usize>(std::numeric_limits<std::ptrdiff_t>::max()) /
+                sizeof(T);
+
+            /// First block: a few elements, but not a few large ones.
+            static constexpr auto min_capacity = sizeof(T) == 1     ? usize{8}
+                                                 : sizeof(T) <= 1024 ? usize{4}
+                                                                     : usize{1};
+
+            /// At least doubles the capacity, so pushes are amortized O(1).
+            [[gnu::noinline]] auto grow(usize additional) noexcept
+                -> Result<void, Error> {
+
+                if (additional > max_capacity - _len) [[unlikely]]
+                    return Err("Vec capacity overflow");
+
+                auto capacity =
+                    std::max({_len + additional, _capacity * 2, min_capacity});
+
+                return this->resize_storage(std::min(capacity, max_capacity));
+            }
+
+            /// Moves the elements to a block of exactly `capacity` slots.
+            auto resize_storage(usize capacity) noexcept
+                -> Result<void, Error> {
+
+                if constexpr (impl::Reallocating<Allocator, T> &&
+                              lx::trait::TriviallyRelocatable<T>) {
+                    if (_ptr != nullptr) {
+                        auto* ptr =
+                            _alloc.reallocate(_ptr, _capacity, capacity);
+                        if (ptr == nullptr) [[unlikely]]
+                            return Err("Vec allocation failed");
+
+                        _ptr = ptr;
+                        _capacity = capacity;
+                        return Ok();
+                    }
+                }
+
+                auto* ptr = Traits::allocate(_alloc, capacity);
+                if (ptr == nullptr) [[unlikely]]
+                    return Err("Vec allocation failed");
+
+                impl::relocate(_ptr, _len, ptr);
+                this->free_storage();
+
+                _ptr = ptr;
+                _capacity = capacity;
+                return Ok();
+            }
+
+            auto free_storage() noexcept -> void {
+                if (_ptr != nullptr)
+                    Traits::deallocate(_alloc, _ptr, _capacity);
+            }
+
+            auto reset() noexcept -> void {
+                this->clear();
+                this->free_storage();
+                _ptr = nullptr;
+                _capacity = 0;
+            }
+
+        private:
+            // First, so that the niche sits at offset 0
+            T* _ptr = nullptr;
+            usize _len = 0;
+            usize _capacity = 0;
+            [[no_unique_address]] Allocator _alloc;
+    };
+
+}; // namespace lx::core
+
+/// Sending a Vec sends its elements
+template <class T, class Alloc>
+struct lx::trait::UnsafeSendMarker<lx::core::Vec<T, Alloc>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+/// A Vec without a block holds nullptr, so its pointer is never 1
+template <class T, class Alloc>
+struct lx::trait::UnsafeNicheMarker<lx::core::Vec<T, Alloc>> {
+        static constexpr auto value = true;
+        static constexpr auto offset = std::size_t{0};
+        static constexpr auto none = lx::trait::pointer_niche;
+};
+
+/// The elements stay in their block; only the handle moves
+template <class T, class Alloc>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<lx::core::Vec<T, Alloc>> {
+        static constexpr auto value = lx::trait::TriviallyRelocatable<
+            typename lx::core::Vec<T, Alloc>::Allocator>;
+};
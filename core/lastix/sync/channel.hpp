@@ -0,0 +1,667 @@
+#pragma once
+
+#include "lastix/core/arc.hpp"
+#include "lastix/core/diagnostics.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/core/result.hpp"
+#include "lastix/trait/send.hpp"
+#include "lastix/trait/sync.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <utility>
+
+namespace lx::sync {
+
+    /// A value send() could not deliver because every Receiver is gone.
+    template <class T> class SendError {
+
+        public:
+            explicit SendError(T value) noexcept : _value(std::move(value)) {
+            }
+
+            [[nodiscard]] auto what() const noexcept -> std::string_view {
+                return "channel is disconnected";
+            }
+
+            /// Takes back the value that was not sent.
+            [[nodiscard]] auto into_inner() && noexcept -> T {
+                return std::move(_value);
+            }
+
+        private:
+            T _value;
+    };
+
+    /// A value try_send() could not deliver, with the reason.
+    template <class T> class TrySendError {
+
+        public:
+            enum class Kind : core::u8 { Full, Disconnected };
+
+            TrySendError(T value, Kind kind) noexcept
+                : _value(std::move(value)), _kind(kind) {
+            }
+
+            [[nodiscard]] auto is_full() const noexcept -> bool {
+                return _kind == Kind::Full;
+            }
+
+            [[nodiscard]] auto is_disconnected() const noexcept -> bool {
+                return _kind == Kind::Disconnected;
+            }
+
+            [[nodiscard]] auto what() const noexcept -> std::string_view {
+                return this->is_full() ? "channel is full"
+                                       : "channel is disconnected";
+            }
+
+            /// Takes back the value that was not sent.
+            [[nodiscard]] auto into_inner() && noexcept -> T {
+                return std::move(_value);
+            }
+
+        private:
+            T _value;
+            Kind _kind;
+    };
+
+    namespace impl {
+
+        /// Keeps indices written by different threads on separate lines.
+        inline constexpr auto cache_line = core::usize{64};
+
+        /**
+         * @brief Wakes the threads blocked on one side of a channel.
+         *
+         * The generation is only bumped while somebody waits, so a send or
+         * receive nobody is blocked on costs a fence and a load, never a
+         * syscall. A waiter registers, re-checks its condition and only then
+         * sleeps on the generation it read before registering.
+         */
+        class WaitSignal {
+
+            public:
+                /// Wakes every waiter, if there are any.
+                auto notify() noexcept -> void {
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (_waiters.load(std::memory_order_relaxed) != 0)
+                        [[unlikely]]
+                        this->wake();
+                }
+
+                /// Wakes every waiter unconditionally, e.g. on disconnect.
+                auto wake() noexcept -> void {
+                    _generation.fetch_add(1, std::memory_order_release);
+                    _generation.notify_all();
+                }
+
+                /// Registers a waiter; re-check the condition afterwards.
+                [[nodiscard]] auto prepare() noexcept -> core::u32 {
+                    auto generation =
+                        _generation.load(std::memory_order_acquire);
+                    _waiters.fetch_add(1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    return generation;
+                }
+
+                /// Unregisters after the re-check found no reason to sleep.
+                auto cancel() noexcept -> void {
+                    _waiters.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+                /// Sleeps until the generation moves past `generation`.
+                auto wait(core::u32 generation) noexcept -> void {
+                    _generation.wait(generation, std::memory_order_acquire);
+                    _waiters.fetch_sub(1, std::memory_order_relaxed);
+                }
+
+            private:
+                std::atomic<core::u32> _generation = 0;
+                std::atomic<core::u32> _waiters = 0;
+        };
+
+        /// Handle counts and wake-ups shared by both ring kinds.
+        struct ChannelShared {
+                std::atomic<core::usize> senders = 1;
+                std::atomic<core::usize> receivers = 1;
+
+                /// Signaled after a push, for blocked receivers.
+                alignas(cache_line) WaitSignal readable;
+                /// Signaled after a pop, for blocked senders.
+                alignas(cache_line) WaitSignal writable;
+        };
+
+        /// Uninitialized room for one T.
+        template <class T> struct RingStorage {
+                alignas(T) std::byte bytes[sizeof(T)];
+
+                [[nodiscard]] auto get() noexcept -> T* {
+                    return std::launder(reinterpret_cast<T*>(bytes));
+                }
+        };
+
+        inline auto ring_capacity(core::usize capacity, core::usize min)
+            -> core::usize {
+
+            if (capacity == 0) [[unlikely]]
+                core::panic("Channel capacity must be non-zero");
+
+            return std::bit_ceil(std::max(capacity, min));
+        }
+
+        /**
+         * @brief Bounded multi-producer multi-consumer ring.
+         *
+         * Every slot carries a sequence number that tells producers and
+         * consumers whose turn it is, so a push or pop claims its position
+         * with one CAS on the tail or head and never waits for another
+         * thread's CAS. The capacity is rounded up to a power of two, and
+         * to at least 2 for the sequence numbers to stay unambiguous.
+         */
+        template <class T> class MpmcRing : public ChannelShared {
+
+            public:
+                using Value = T;
+                static constexpr auto multi_producer = true;
+                static constexpr auto multi_consumer = true;
+
+                explicit MpmcRing(core::usize capacity) noexcept
+                    : _mask(ring_capacity(capacity, 2) - 1),
+                      _slots(new Slot[_mask + 1]) {
+
+                    for (auto i = core::usize{0}; i <= _mask; i++)
+                        _slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+
+                MpmcRing(const MpmcRing&) = delete;
+                auto operator=(const MpmcRing&) -> MpmcRing& = delete;
+
+                ~MpmcRing() noexcept {
+                    while (this->pop().is_some()) {
+                    }
+                }
+
+                /// Moves value in unless the ring is full.
+                auto push(T& value) noexcept -> bool {
+
+                    auto pos = _tail.load(std::memory_order_relaxed);
+
+                    while (true) {
+                        auto& slot = _slots[pos & _mask];
+                        auto sequence =
+                            slot.sequence.load(std::memory_order_acquire);
+                        auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+
+                        if (diff == 0) {
+                            if (_tail.compare_exchange_weak(
+                                    pos, pos + 1, std::memory_order_relaxed,
+                                    std::memory_order_relaxed)) {
+                                std::construct_at(slot.storage.get(),
+                                                  std::move(value));
+                                slot.sequence.store(pos + 1,
+                                                    std::memory_order_release);
+                                return true;
+                            }
+                        } else if (diff < 0) {
+                            // The slot still holds the value from a lap ago
+                            return false;
+                        } else {
+                            pos = _tail.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                auto pop() noexcept -> core::Option<T> {
+
+                    auto pos = _head.load(std::memory_order_relaxed);
+
+                    while (true) {
+                        auto& slot = _slots[pos & _mask];
+                        auto sequence =
+                            slot.sequence.load(std::memory_order_acquire);
+                        auto diff =
+                            static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+
+                        if (diff == 0) {
+                            if (_head.compare_exchange_weak(
+                                    pos, pos + 1, std::memory_order_relaxed,
+                                    std::memory_order_relaxed)) {
+                                auto* item = slot.storage.get();
+                                auto value = core::Option<T>(
+                                    core::Some(std::move(*item)));
+                                std::destroy_at(item);
+
+                                // Hand the slot to the producer one lap ahead
+                                slot.sequence.store(pos + _mask + 1,
+                                                    std::memory_order_release);
+                                return value;
+                            }
+                        } else if (diff < 0) {
+                            return core::None;
+                        } else {
+                            pos = _head.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                [[nodiscard]] auto is_full() const noexcept -> bool {
+                    auto head = _head.load(std::memory_order_acquire);
+                    return _tail.load(std::memory_order_acquire) - head > _mask;
+                }
+
+                [[nodiscard]] auto capacity() const noexcept -> core::usize {
+                    return _mask + 1;
+                }
+
+            private:
+                struct Slot {
+                        std::atomic<core::usize> sequence;
+                        RingStorage<T> storage;
+                };
+
+            private:
+                alignas(cache_line) std::atomic<core::usize> _head = 0;
+                alignas(cache_line) std::atomic<core::usize> _tail = 0;
+
+                // Read-only after construction
+                alignas(cache_line) core::usize _mask;
+                std::unique_ptr<Slot[]> _slots;
+        };
+
+        /**
+         * @brief Wait-free single-producer single-consumer ring.
+         *
+         * Each side owns one index and keeps a cached copy of the other's,
+         * so it only reads the other side's cache line when the cached
+         * value says the ring is full (or empty). The capacity is rounded
+         * up to a power of two.
+         */
+        template <class T> class SpscRing : public ChannelShared {
+
+            public:
+                using Value = T;
+                static constexpr auto multi_producer = false;
+                static constexpr auto multi_consumer = false;
+
+                explicit SpscRing(core::usize capacity) noexcept
+                    : _mask(ring_capacity(capacity, 1) - 1),
+                      _slots(new RingStorage<T>[_mask + 1]) {
+                }
+
+                SpscRing(const SpscRing&) = delete;
+                auto operator=(const SpscRing&) -> SpscRing& = delete;
+
+                ~SpscRing() noexcept {
+                    while (this->pop().is_some()) {
+                    }
+                }
+
+                /// Producer only: moves value in unless the ring is full.
+                auto push(T& value) noexcept -> bool {
+
+                    auto tail = _producer.tail.load(std::memory_order_relaxed);
+
+                    if (tail - _producer.head_cache > _mask) {
+                        _producer.head_cache =
+                            _consumer.head.load(std::memory_order_acquire);
+                        if (tail - _producer.head_cache > _mask) return false;
+                    }
+
+                    std::construct_at(_slots[tail & _mask].get(),
+                                      std::move(value));
+                    _producer.tail.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+
+                /// Consumer only.
+                auto pop() noexcept -> core::Option<T> {
+
+                    auto head = _consumer.head.load(std::memory_order_relaxed);
+
+                    if (head == _consumer.tail_cache) {
+                        _consumer.tail_cache =
+                            _producer.tail.load(std::memory_order_acquire);
+                        if (head == _consumer.tail_cache) return core::None;
+                    }
+
+                    auto* item = _slots[head & _mask].get();
+                    auto value = core::Option<T>(core::Some(std::move(*item)));
+                    std::destroy_at(item);
+
+                    _consumer.head.store(head + 1, std::memory_order_release);
+                    return value;
+                }
+
+                [[nodiscard]] auto is_full() const noexcept -> bool {
+                    auto head = _consumer.head.load(std::memory_order_acquire);
+                    return _producer.tail.load(std::memory_order_acquire) -
+                               head >
+                           _mask;
+                }
+
+                [[nodiscard]] auto capacity() const noexcept -> core::usize {
+                    return _mask + 1;
+                }
+
+            private:
+                struct alignas(cache_line) Producer {
+                        std::atomic<core::usize> tail = 0;
+                        core::usize head_cache = 0;
+                };
+
+                struct alignas(cache_line) Consumer {
+                        std::atomic<core::usize> head = 0;
+                        core::usize tail_cache = 0;
+                };
+
+            private:
+                Producer _producer;
+                Consumer _consumer;
+
+                // Read-only after construction
+                alignas(cache_line) core::usize _mask;
+                std::unique_ptr<RingStorage<T>[]> _slots;
+        };
+
+        /**
+         * @brief Sending half of a channel over Ring. Copyable when the
+         * ring allows several producers; the channel disconnects for the
+         * receivers once the last copy is dropped.
+         */
+        template <class Ring> class ChannelSender {
+
+            public:
+                using Value = typename Ring::Value;
+
+                /// Adopts one of the sender counts already held by ring.
+                explicit ChannelSender(core::Arc<Ring> ring) noexcept
+                    : _ring(std::move(ring)) {
+                }
+
+                ChannelSender(const ChannelSender& other) noexcept
+                requires(Ring::multi_producer)
+                    : _ring(other._ring) {
+                    _ring->senders.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                auto operator=(const ChannelSender& other) noexcept
+                    -> ChannelSender&
+                requires(Ring::multi_producer)
+                {
+                    if (this != &other) *this = ChannelSender(other);
+                    return *this;
+                }
+
+                ChannelSender(ChannelSender&&) noexcept = default;
+
+                auto operator=(ChannelSender&& other) noexcept
+                    -> ChannelSender& {
+                    if (this != &other) {
+                        this->disconnect();
+                        _ring = std::move(other._ring);
+                    }
+                    return *this;
+                }
+
+                ~ChannelSender() noexcept {
+                    this->disconnect();
+                }
+
+                /// Sends value unless the channel is full or disconnected.
+                auto try_send(Value value) noexcept
+                    -> core::Result<void, TrySendError<Value>> {
+
+                    auto& ring = *_ring;
+
+                    if (ring.receivers.load(std::memory_order_acquire) == 0)
+                        [[unlikely]]
+                        return core::Err(TrySendError<Value>(
+                            std::move(value),
+                            TrySendError<Value>::Kind::Disconnected));
+
+                    if (!ring.push(value))
+                        return core::Err(TrySendError<Value>(
+                            std::move(value), TrySendError<Value>::Kind::Full));
+
+                    ring.readable.notify();
+                    return core::Ok();
+                }
+
+                /**
+                 * @brief Sends value, blocking while the channel is full.
+                 * Fails only once every Receiver is gone.
+                 */
+                auto send(Value value) noexcept
+                    -> core::Result<void, SendError<Value>> {
+
+                    auto& ring = *_ring;
+
+                    while (true) {
+                        if (ring.receivers.load(std::memory_order_acquire) ==
+                            0) [[unlikely]]
+                            return core::Err(
+                                SendError<Value>(std::move(value)));
+
+                        if (ring.push(value)) {
+                            ring.readable.notify();
+                            return core::Ok();
+                        }
+
+                        // From here on a pop or a disconnect wakes us up
+                        auto generation = ring.writable.prepare();
+
+                        if (ring.receivers.load(std::memory_order_acquire) ==
+                                0 ||
+                            !ring.is_full())
+                            ring.writable.cancel();
+                        else
+                            ring.writable.wait(generation);
+                    }
+                }
+
+                /// Whether every Receiver is gone.
+                [[nodiscard]] auto is_disconnected() const noexcept -> bool {
+                    return _ring->receivers.load(std::memory_order_acquire) ==
+                           0;
+                }
+
+                [[nodiscard]] auto capacity() const noexcept -> core::usize {
+                    return _ring->capacity();
+                }
+
+            private:
+                auto disconnect() noexcept -> void {
+                    if (!_ring) return;
+
+                    if (_ring->senders.fetch_sub(
+                            1, std::memory_order_acq_rel) == 1)
+                        _ring->readable.wake();
+                }
+
+            private:
+                core::Arc<Ring> _ring;
+        };
+
+        /**
+         * @brief Receiving half of a channel over Ring. Copyable when the
+         * ring allows several consumers; each value is received by exactly
+         * one of the copies.
+         */
+        template <class Ring> class ChannelReceiver {
+
+            public:
+                using Value = typename Ring::Value;
+
+                /// Adopts one of the receiver counts already held by ring.
+                explicit ChannelReceiver(core::Arc<Ring> ring) noexcept
+                    : _ring(std::move(ring)) {
+                }
+
+                ChannelReceiver(const ChannelReceiver& other) noexcept
+                requires(Ring::multi_consumer)
+                    : _ring(other._ring) {
+                    _ring->receivers.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                auto operator=(const ChannelReceiver& other) noexcept
+                    -> ChannelReceiver&
+                requires(Ring::multi_consumer)
+                {
+                    if (this != &other) *this = ChannelReceiver(other);
+                    return *this;
+                }
+
+                ChannelReceiver(ChannelReceiver&&) noexcept = default;
+
+                auto operator=(ChannelReceiver&& other) noexcept
+                    -> ChannelReceiver& {
+                    if (this != &other) {
+                        this->disconnect();
+                        _ring = std::move(other._ring);
+                    }
+                    return *this;
+                }
+
+                ~ChannelReceiver() noexcept {
+                    this->disconnect();
+                }
+
+                /// Takes a value if one is ready.
+                auto try_recv() noexcept -> core::Option<Value> {
+
+                    auto& ring = *_ring;
+                    auto value = ring.pop();
+
+                    if (value.is_some()) ring.writable.notify();
+
+                    return value;
+                }
+
+                /**
+                 * @brief Takes a value, blocking while the channel is empty.
+                 * Returns None once the channel is empty and every Sender
+                 * is gone.
+                 */
+                auto recv() noexcept -> core::Option<Value> {
+
+                    auto& ring = *_ring;
+
+                    while (true) {
+                        if (auto value = this->try_recv(); value.is_some())
+                            return value;
+
+                        // Senders push before they disconnect, so one more
+                        // pop sees anything sent before the last one left
+                        if (ring.senders.load(std::memory_order_acquire) == 0)
+                            [[unlikely]]
+                            return this->try_recv();
+
+                        // From here on a push or a disconnect wakes us up
+                        auto generation = ring.readable.prepare();
+
+                        if (auto value = ring.pop(); value.is_some()) {
+                            ring.readable.cancel();
+                            ring.writable.notify();
+                            return value;
+                        }
+
+                        if (ring.senders.load(std::memory_order_acquire) == 0)
+                            ring.readable.cancel();
+                        else
+                            ring.readable.wait(generation);
+                    }
+                }
+
+                /// Whether every Sender is gone. Values may still be queued.
+                [[nodiscard]] auto is_disconnected() const noexcept -> bool {
+                    return _ring->senders.load(std::memory_order_acquire) == 0;
+                }
+
+                [[nodiscard]] auto capacity() const noexcept -> core::usize {
+                    return _ring->capacity();
+                }
+
+            private:
+                auto disconnect() noexcept -> void {
+                    if (!_ring) return;
+
+                    if (_ring->receivers.fetch_sub(
+                            1, std::memory_order_acq_rel) == 1)
+                        _ring->writable.wake();
+                }
+
+            private:
+                core::Arc<Ring> _ring;
+        };
+
+    }; // namespace impl
+
+    template <class T> using Sender = impl::ChannelSender<impl::MpmcRing<T>>;
+    template <class T>
+    using Receiver = impl::ChannelReceiver<impl::MpmcRing<T>>;
+
+    template <class T>
+    using SpscSender = impl::ChannelSender<impl::SpscRing<T>>;
+    template <class T>
+    using SpscReceiver = impl::ChannelReceiver<impl::SpscRing<T>>;
+
+    /**
+     * @brief Bounded channel for any number of senders and receivers.
+     *
+     * Clone either half to add producers or consumers. try_send() and
+     * try_recv() never block; send() and recv() sleep on std::atomic::wait
+     * only when the channel is full or empty. The capacity is rounded up
+     * to a power of two (at least 2).
+     */
+    template <class T>
+    [[nodiscard]] auto channel(core::usize capacity) noexcept
+        -> std::pair<Sender<T>, Receiver<T>> {
+
+        auto ring = core::Arc<impl::MpmcRing<T>>(capacity);
+        return {Sender<T>(ring), Receiver<T>(std::move(ring))};
+    }
+
+    /**
+     * @brief Bounded channel for exactly one sender and one receiver.
+     *
+     * Neither half can be cloned, which lets push and pop go without any
+     * read-modify-write. The capacity is rounded up to a power of two.
+     */
+    template <class T>
+    [[nodiscard]] auto spsc_channel(core::usize capacity) noexcept
+        -> std::pair<SpscSender<T>, SpscReceiver<T>> {
+
+        auto ring = core::Arc<impl::SpscRing<T>>(capacity);
+        return {SpscSender<T>(ring), SpscReceiver<T>(std::move(ring))};
+    }
+
+}; // namespace lx::sync
+
+/// The rings synchronize every access themselves
+template <class T>
+struct lx::trait::UnsafeSyncMarker<lx::sync::impl::MpmcRing<T>> {
+        static constexpr auto value = true;
+};
+
+template <class T>
+struct lx::trait::UnsafeSyncMarker<lx::sync::impl::SpscRing<T>> {
+        static constexpr auto value = true;
+};
+
+/// Sending a handle lets the other thread send or receive T
+template <class Ring>
+struct lx::trait::UnsafeSendMarker<lx::sync::impl::ChannelSender<Ring>> {
+        static constexpr auto value = lx::trait::Send<typename Ring::Value>;
+};
+
+template <class Ring>
+struct lx::trait::UnsafeSendMarker<lx::sync::impl::ChannelReceiver<Ring>> {
+        static constexpr auto value = lx::trait::Send<typename Ring::Value>;
+};
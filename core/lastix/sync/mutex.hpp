@@ -0,0 +1,236 @@
+#pragma once
+
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/trait/send.hpp"
+#include "lastix/trait/sync.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <utility>
+
+namespace lx::sync {
+
+    namespace impl {
+
+        /// Tells the core we are busy-waiting.
+        inline auto cpu_relax() noexcept -> void {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        }
+
+        /**
+         * @brief Three-state lock word: 0 unlocked, 1 locked, 2 locked
+         * with possible waiters.
+         *
+         * lock() takes an unlocked word with one CAS, spins for a while if
+         * the holder is likely to be done soon and only then sleeps with
+         * std::atomic::wait. unlock() only issues a wake-up when the word
+         * says somebody may be asleep.
+         */
+        class RawMutex {
+
+            public:
+                RawMutex() noexcept = default;
+
+                RawMutex(const RawMutex&) = delete;
+                auto operator=(const RawMutex&) -> RawMutex& = delete;
+
+                auto lock() noexcept -> void {
+                    auto state = unlocked;
+                    if (!_state.compare_exchange_weak(
+                            state, locked, std::memory_order_acquire,
+                            std::memory_order_relaxed)) [[unlikely]]
+                        this->lock_slow();
+                }
+
+                [[nodiscard]] auto try_lock() noexcept -> bool {
+                    auto state = unlocked;
+                    return _state.compare_exchange_strong(
+                        state, locked, std::memory_order_acquire,
+                        std::memory_order_relaxed);
+                }
+
+                /// Unlocks and wakes one sleeping thread, if any.
+                auto unlock() noexcept -> void {
+                    if (_state.exchange(unlocked, std::memory_order_release) ==
+                        contended) [[unlikely]]
+                        _state.notify_one();
+                }
+
+                /**
+                 * @brief Unlocks and wakes every sleeping thread. Needed when
+                 * threads other than lock() callers sleep on the word.
+                 */
+                auto unlock_all() noexcept -> void {
+                    if (_state.exchange(unlocked, std::memory_order_release) ==
+                        contended) [[unlikely]]
+                        _state.notify_all();
+                }
+
+                [[nodiscard]] auto is_locked() const noexcept -> bool {
+                    return _state.load(std::memory_order_seq_cst) != unlocked;
+                }
+
+                /// Blocks until the word is unlocked, without taking it.
+                auto wait_unlocked() noexcept -> void {
+
+                    auto state = _state.load(std::memory_order_acquire);
+
+                    while (state != unlocked) {
+                        if (state == locked &&
+                            !_state.compare_exchange_weak(
+                                state, contended, std::memory_order_relaxed,
+                                std::memory_order_acquire))
+                            continue;
+
+                        _state.wait(contended, std::memory_order_acquire);
+                        state = _state.load(std::memory_order_acquire);
+                    }
+                }
+
+            private:
+                static constexpr auto unlocked = core::u32{0};
+                static constexpr auto locked = core::u32{1};
+                static constexpr auto contended = core::u32{2};
+
+                /// Spins before sleeping; about the cost of a futex round trip.
+                static constexpr auto spin_limit = 100;
+
+                auto lock_slow() noexcept -> void {
+
+                    // Spin only while nobody sleeps: a sleeper means the lock
+                    // is held long enough that spinning would be wasted
+                    for (auto i = 0; i < spin_limit; i++) {
+                        auto state = _state.load(std::memory_order_relaxed);
+
+                        if (state == unlocked && this->try_lock()) return;
+                        if (state == contended) break;
+
+                        cpu_relax();
+                    }
+
+                    // Once we may have slept, take the lock as contended: we
+                    // cannot know whether other sleepers remain
+                    while (_state.exchange(contended,
+                                           std::memory_order_acquire) !=
+                           unlocked)
+                        _state.wait(contended, std::memory_order_relaxed);
+                }
+
+            private:
+                std::atomic<core::u32> _state = unlocked;
+        };
+
+    }; // namespace impl
+
+    template <class T> class Mutex;
+
+    /// Access to the value of a locked Mutex; unlocks when dropped.
+    template <class T> class MutexGuard {
+
+        public:
+            MutexGuard(MutexGuard&& other) noexcept
+                : _mutex(std::exchange(other._mutex, nullptr)) {
+            }
+
+            auto operator=(MutexGuard&& other) noexcept -> MutexGuard& {
+                if (this != &other) {
+                    this->unlock();
+                    _mutex = std::exchange(other._mutex, nullptr);
+                }
+                return *this;
+            }
+
+            ~MutexGuard() noexcept {
+                this->unlock();
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> T* {
+                return &_mutex->_value;
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> T& {
+                return _mutex->_value;
+            }
+
+        private:
+            friend class Mutex<T>;
+
+            explicit MutexGuard(Mutex<T>& mutex) noexcept : _mutex(&mutex) {
+            }
+
+            auto unlock() noexcept -> void {
+                if (_mutex != nullptr) _mutex->_raw.unlock();
+            }
+
+        private:
+            Mutex<T>* _mutex;
+    };
+
+    /**
+     * @brief Owns a T and hands it out to one thread at a time.
+     *
+     * The value is only reachable through the MutexGuard returned by
+     * lock() or try_lock(), so it cannot be touched without holding the
+     * lock. A Mutex is Sync whenever T is Send, which is what lets an
+     * Arc<Mutex<T>> give every thread access to it.
+     */
+    template <class T> class Mutex {
+
+        public:
+            /// Constructs the protected value in place.
+            template <class... Args>
+            requires std::constructible_from<T, Args...>
+            explicit Mutex(Args&&... args) noexcept
+                : _value(std::forward<Args>(args)...) {
+            }
+
+            Mutex(const Mutex&) = delete;
+            auto operator=(const Mutex&) -> Mutex& = delete;
+
+            [[nodiscard]] auto lock() noexcept -> MutexGuard<T> {
+                _raw.lock();
+                return MutexGuard<T>(*this);
+            }
+
+            /// Locks only if nobody holds the lock right now.
+            [[nodiscard]] auto try_lock() noexcept
+                -> core::Option<MutexGuard<T>> {
+
+                if (!_raw.try_lock()) return core::None;
+
+                return core::Some(MutexGuard<T>(*this));
+            }
+
+            [[nodiscard]] auto is_locked() const noexcept -> bool {
+                return _raw.is_locked();
+            }
+
+            /// Takes the value out; nobody else can hold the lock.
+            [[nodiscard]] auto into_inner() && noexcept -> T {
+                return std::move(_value);
+            }
+
+        private:
+            friend class MutexGuard<T>;
+
+            impl::RawMutex _raw;
+            T _value;
+    };
+
+}; // namespace lx::sync
+
+/// Locking gives one thread at a time the T, which must be able to move
+template <class T> struct lx::trait::UnsafeSyncMarker<lx::sync::Mutex<T>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+/// A guard unlocks on the thread that locked
+template <class T>
+struct lx::trait::UnsafeSendMarker<lx::sync::MutexGuard<T>> {
+        static constexpr auto value = false;
+};
@@ -0,0 +1,39 @@
+#include "lastix/sync/rwlock.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <thread>
+
+namespace lx::sync::impl {
+
+    namespace {
+
+        /// More slots than this only costs writers.
+        constexpr auto max_reader_slots = core::usize{64};
+
+        std::atomic<core::usize> next_hint = 0;
+
+    }; // namespace
+
+    auto reader_slot_count() noexcept -> core::usize {
+
+        static const auto count = [] {
+            auto cores = static_cast<core::usize>(
+                std::max(std::thread::hardware_concurrency(), 1u));
+            return std::min(std::bit_ceil(cores), max_reader_slots);
+        }();
+
+        return count;
+    }
+
+    auto reader_slot_hint() noexcept -> core::usize {
+
+        // Round robin spreads threads evenly; the index never changes, so a
+        // thread keeps hitting a line that stays in its core's cache
+        thread_local const auto hint =
+            next_hint.fetch_add(1, std::memory_order_relaxed);
+
+        return hint;
+    }
+
+}; // namespace lx::sync::impl
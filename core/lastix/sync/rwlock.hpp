@@ -0,0 +1,305 @@
+#pragma once
+
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/sync/mutex.hpp"
+#include "lastix/trait/send.hpp"
+#include "lastix/trait/sync.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <memory>
+#include <utility>
+
+namespace lx::sync {
+
+    namespace impl {
+
+        /// One reader counter on its own cache line.
+        struct alignas(64) ReaderSlot {
+                std::atomic<core::u32> readers = 0;
+        };
+
+        /// Slots per RwLock: the core count rounded up to a power of two.
+        [[nodiscard]] auto reader_slot_count() noexcept -> core::usize;
+
+        /// Stable per-thread index; callers mask it to their slot count.
+        [[nodiscard]] auto reader_slot_hint() noexcept -> core::usize;
+
+        /**
+         * @brief Reader-writer lock whose readers never share a counter
+         * with readers on other cores.
+         *
+         * A reader bumps the counter of its thread's slot and checks that
+         * no writer is around; a writer takes the writer word, which makes
+         * new readers back off, and then waits for every slot to drain.
+         * Read locking therefore stays on a line only its own thread (and
+         * the few threads hashed to the same slot) writes, while write
+         * locking costs one pass over all slots.
+         */
+        class RawRwLock {
+
+            public:
+                RawRwLock() noexcept
+                    : _mask(reader_slot_count() - 1),
+                      _slots(new ReaderSlot[_mask + 1]) {
+                }
+
+                RawRwLock(const RawRwLock&) = delete;
+                auto operator=(const RawRwLock&) -> RawRwLock& = delete;
+
+                /// Returns the slot to hand back to unlock_shared().
+                [[nodiscard]] auto lock_shared() noexcept -> ReaderSlot& {
+
+                    auto& slot = _slots[reader_slot_hint() & _mask];
+
+                    while (!this->enter(slot)) _writer.wait_unlocked();
+
+                    return slot;
+                }
+
+                [[nodiscard]] auto try_lock_shared() noexcept -> ReaderSlot* {
+                    auto& slot = _slots[reader_slot_hint() & _mask];
+                    return this->enter(slot) ? &slot : nullptr;
+                }
+
+                auto unlock_shared(ReaderSlot& slot) noexcept -> void {
+
+                    // Dekker with the writer: it sets the writer word, then
+                    // reads the counters
+                    if (slot.readers.fetch_sub(1, std::memory_order_seq_cst) ==
+                            1 &&
+                        _writer.is_locked()) [[unlikely]]
+                        slot.readers.notify_all();
+                }
+
+                auto lock() noexcept -> void {
+                    _writer.lock();
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    for (auto i = core::usize{0}; i <= _mask; i++) {
+                        auto& readers = _slots[i].readers;
+                        auto count = readers.load(std::memory_order_acquire);
+
+                        while (count != 0) {
+                            readers.wait(count, std::memory_order_acquire);
+                            count = readers.load(std::memory_order_acquire);
+                        }
+                    }
+                }
+
+                [[nodiscard]] auto try_lock() noexcept -> bool {
+
+                    if (!_writer.try_lock()) return false;
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    for (auto i = core::usize{0}; i <= _mask; i++) {
+                        if (_slots[i].readers.load(std::memory_order_acquire) !=
+                            0) {
+                            _writer.unlock_all();
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+
+                auto unlock() noexcept -> void {
+                    // Readers backing off sleep on the same word as writers
+                    _writer.unlock_all();
+                }
+
+            private:
+                /// Registers a reader unless a writer holds or awaits the lock.
+                auto enter(ReaderSlot& slot) noexcept -> bool {
+
+                    slot.readers.fetch_add(1, std::memory_order_seq_cst);
+                    if (!_writer.is_locked()) [[likely]]
+                        return true;
+
+                    this->unlock_shared(slot);
+                    return false;
+                }
+
+            private:
+                RawMutex _writer;
+                core::usize _mask;
+                std::unique_ptr<ReaderSlot[]> _slots;
+        };
+
+    }; // namespace impl
+
+    template <class T> class RwLock;
+
+    /// Shared access to the value of a RwLock; unlocks when dropped.
+    template <class T> class RwLockReadGuard {
+
+        public:
+            RwLockReadGuard(RwLockReadGuard&& other) noexcept
+                : _lock(std::exchange(other._lock, nullptr)),
+                  _slot(other._slot) {
+            }
+
+            auto operator=(RwLockReadGuard&& other) noexcept
+                -> RwLockReadGuard& {
+                if (this != &other) {
+                    this->unlock();
+                    _lock = std::exchange(other._lock, nullptr);
+                    _slot = other._slot;
+                }
+                return *this;
+            }
+
+            ~RwLockReadGuard() noexcept {
+                this->unlock();
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> const T* {
+                return &_lock->_value;
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> const T& {
+                return _lock->_value;
+            }
+
+        private:
+            friend class RwLock<T>;
+
+            RwLockReadGuard(RwLock<T>& lock, impl::ReaderSlot& slot) noexcept
+                : _lock(&lock), _slot(&slot) {
+            }
+
+            auto unlock() noexcept -> void {
+                if (_lock != nullptr) _lock->_raw.unlock_shared(*_slot);
+            }
+
+        private:
+            RwLock<T>* _lock;
+            impl::ReaderSlot* _slot;
+    };
+
+    /// Exclusive access to the value of a RwLock; unlocks when dropped.
+    template <class T> class RwLockWriteGuard {
+
+        public:
+            RwLockWriteGuard(RwLockWriteGuard&& other) noexcept
+                : _lock(std::exchange(other._lock, nullptr)) {
+            }
+
+            auto operator=(RwLockWriteGuard&& other) noexcept
+                -> RwLockWriteGuard& {
+                if (this != &other) {
+                    this->unlock();
+                    _lock = std::exchange(other._lock, nullptr);
+                }
+                return *this;
+            }
+
+            ~RwLockWriteGuard() noexcept {
+                this->unlock();
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> T* {
+                return &_lock->_value;
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> T& {
+                return _lock->_value;
+            }
+
+        private:
+            friend class RwLock<T>;
+
+            explicit RwLockWriteGuard(RwLock<T>& lock) noexcept
+                : _lock(&lock) {
+            }
+
+            auto unlock() noexcept -> void {
+                if (_lock != nullptr) _lock->_raw.unlock();
+            }
+
+        private:
+            RwLock<T>* _lock;
+    };
+
+    /**
+     * @brief Owns a T that many threads may read at once, or one thread
+     * may write.
+     *
+     * Each reader counts itself on a per-thread cache line instead of one
+     * shared word, so read-mostly workloads scale with the core count. The
+     * price is paid by writers, which scan every slot, and by memory: one
+     * cache line per slot. A waiting writer keeps new readers out, so
+     * writers are not starved.
+     */
+    template <class T> class RwLock {
+
+        public:
+            /// Constructs the protected value in place.
+            template <class... Args>
+            requires std::constructible_from<T, Args...>
+            explicit RwLock(Args&&... args) noexcept
+                : _value(std::forward<Args>(args)...) {
+            }
+
+            RwLock(const RwLock&) = delete;
+            auto operator=(const RwLock&) -> RwLock& = delete;
+
+            [[nodiscard]] auto read() noexcept -> RwLockReadGuard<T> {
+                return RwLockReadGuard<T>(*this, _raw.lock_shared());
+            }
+
+            /// Read-locks only if no writer holds or awaits the lock.
+            [[nodiscard]] auto try_read() noexcept
+                -> core::Option<RwLockReadGuard<T>> {
+
+                auto* slot = _raw.try_lock_shared();
+                if (slot == nullptr) return core::None;
+
+                return core::Some(RwLockReadGuard<T>(*this, *slot));
+            }
+
+            [[nodiscard]] auto write() noexcept -> RwLockWriteGuard<T> {
+                _raw.lock();
+                return RwLockWriteGuard<T>(*this);
+            }
+
+            /// Write-locks only if nobody holds the lock right now.
+            [[nodiscard]] auto try_write() noexcept
+                -> core::Option<RwLockWriteGuard<T>> {
+
+                if (!_raw.try_lock()) return core::None;
+
+                return core::Some(RwLockWriteGuard<T>(*this));
+            }
+
+            /// Takes the value out; nobody else can hold the lock.
+            [[nodiscard]] auto into_inner() && noexcept -> T {
+                return std::move(_value);
+            }
+
+        private:
+            friend class RwLockReadGuard<T>;
+            friend class RwLockWriteGuard<T>;
+
+            impl::RawRwLock _raw;
+            T _value;
+    };
+
+}; // namespace lx::sync
+
+/// Readers share a const T; writers get it one at a time
+template <class T> struct lx::trait::UnsafeSyncMarker<lx::sync::RwLock<T>> {
+        static constexpr auto value = lx::trait::Send<T>;
+};
+
+/// A guard unlocks on the thread that locked
+template <class T>
+struct lx::trait::UnsafeSendMarker<lx::sync::RwLockReadGuard<T>> {
+        static constexpr auto value = false;
+};
+
+template <class T>
+struct lx::trait::UnsafeSendMarker<lx::sync::RwLockWriteGuard<T>> {
+        static constexpr auto value = false;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <concepts>
+#include <string_view>
+
+namespace lx::trait {
+
+    /**
+     * Tells lx::core::Error how to get the message of a typed payload. Types
+     * with a `what()` member work as they are; others, such as error code
+     * enums, specialize ErrorImpl with a static what(const E&).
+     */
+    template <class E> struct ErrorImpl {
+            static auto what(const E& e) noexcept -> std::string_view
+            requires requires {
+                { e.what() } -> std::convertible_to<std::string_view>;
+            }
+            {
+                return e.what();
+            }
+    };
+
+    template <class E>
+    concept ErrorPayload = requires(const E& e) {
+        { ErrorImpl<E>::what(e) } -> std::convertible_to<std::string_view>;
+    };
+
+}; // namespace lx::trait
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+namespace lx::trait {
+
+    /**
+     * Tells lx::core::IntrusiveArc where T keeps its reference count. The
+     * default uses the counter returned by `value.ref_count()`, which types
+     * get by deriving from lx::core::AtomicRefCount or LocalRefCount;
+     * specialize it for a counter that is a plain member instead.
+     */
+    template <class T> struct IntrusiveImpl {
+            static auto counter(const T& value) noexcept -> decltype(auto)
+            requires requires { value.ref_count(); }
+            {
+                return value.ref_count();
+            }
+    };
+
+    /**
+     * A counter has retain(), release() returning true once the last
+     * reference is gone, count(), and a static `atomic` flag telling whether
+     * handles may be shared between threads.
+     */
+    template <class T>
+    concept Intrusive = requires(const T& value) {
+        IntrusiveImpl<T>::counter(value).retain();
+        { IntrusiveImpl<T>::counter(value).release() } -> std::same_as<bool>;
+        {
+            std::remove_cvref_t<decltype(IntrusiveImpl<T>::counter(
+                value))>::atomic
+        } -> std::convertible_to<bool>;
+    };
+
+}; // namespace lx::trait
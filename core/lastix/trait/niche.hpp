@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lx::trait {
+
+    /**
+     * Types opt in by declaring a pointer-sized word that never holds `none`
+     * while an object is alive. Option<T> then keeps None in that word
+     * instead of a separate engaged flag, so it is exactly as big as T.
+     *
+     * Specializations set value = true, `offset` to the byte offset of the
+     * word inside T and `none` to the bit pattern that marks None. Getting
+     * either wrong makes Option read live objects as None.
+     */
+    template <class T> struct UnsafeNicheMarker {
+            static constexpr auto value = false;
+    };
+
+    template <class T>
+    concept Niche = UnsafeNicheMarker<T>::value;
+
+    /**
+     * Pattern used by the smart pointers: no object lives at address 1, and
+     * unlike nullptr it is never held by an empty or moved-from handle.
+     */
+    static constexpr auto pointer_niche = std::uintptr_t{1};
+
+}; // namespace lx::trait
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <type_traits>
+
+namespace lx::trait {
+
+    /**
+     * Types whose objects can be moved to new memory by copying their bytes,
+     * with the old bytes then forgotten instead of destroyed. Containers use
+     * memcpy/memmove/realloc for them instead of a move and a destructor
+     * call per element.
+     *
+     * Trivially copyable types qualify. Handles whose state is only
+     * pointers into the heap, like Box and Arc, opt in with value = true;
+     * anything that points into itself (a small-string buffer, an intrusive
+     * list node) must not.
+     */
+    template <class T> struct UnsafeTriviallyRelocatableMarker {
+            static constexpr auto value = std::is_trivially_copyable_v<T>;
+    };
+
+    template <class T>
+    concept TriviallyRelocatable = UnsafeTriviallyRelocatableMarker<T>::value;
+
+}; // namespace lx::trait
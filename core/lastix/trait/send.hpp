@@ -0,0 +1,22 @@
+#pragma once
+
+namespace lx::trait {
+
+    /**
+     * Types are Send unless they opt out. Specialize with value = false for
+     * types whose handles must never be used from another thread, and
+     * forward to Send<T> for wrappers that would carry such a T along.
+     */
+    template <class T> struct UnsafeSendMarker {
+            static constexpr auto value = true;
+    };
+
+    template <class T>
+    concept Send = UnsafeSendMarker<T>::value;
+
+    /// An array is Send when its elements are
+    template <class T> struct UnsafeSendMarker<T[]> {
+            static constexpr auto value = Send<T>;
+    };
+
+}; // namespace lx::trait
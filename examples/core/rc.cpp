@@ -0,0 +1,41 @@
+#include "lastix/core/rc.hpp"
+#include "lastix/core/arc.hpp"
+#include "lastix/core/thread.hpp"
+
+#include <print>
+
+using namespace lx::core;
+
+struct Node {
+        i32 value;
+        RcWeak<Node> parent;
+};
+
+auto main() -> i32 {
+    // Rc is Arc without atomics: cheap to clone, but bound to one thread
+    auto root = Rc<Node>(1, RcWeak<Node>());
+    auto child = Rc<Node>(2, root.downgrade());
+
+    // Weak back-references do not keep the parent alive
+    auto parent = child->parent.upgrade();
+    std::println("child's parent = {}", parent.unwrap()->value);
+    std::println("root strong = {}, weak = {}", root.strong_count().unwrap(),
+                 root.weak_count().unwrap());
+
+    parent = None;
+    root.reset();
+    std::println("parent after reset is none? {}",
+                 child->parent.upgrade().is_none());
+
+    // spawn() only accepts Send arguments. Arc is Send:
+    auto t = spawn(
+        [](Arc<i32> shared) {
+            std::println("Thread B: *shared = {}", *shared);
+        },
+        Arc<i32>(42));
+
+    // Rc is not, this won't compile:
+    // auto u = spawn([](Rc<i32> local) {}, Rc<i32>(42));
+
+    return 0;
+}
@@ -2,6 +2,13 @@
 #include "lastix/core/arc.hpp"
 #include "memory_helpers.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
 TEST_CASE("Arc basic construction", "[lx::core::Arc]") {
     auto ptr = Arc<TestStruct>(42);
     REQUIRE(static_cast<bool>(ptr));
@@ -101,3 +108,396 @@ TEST_CASE("Arc mutable dereference", "[lx::core::Arc]") {
     *x = 10;
     REQUIRE(x->load() == 10);
 }
+
+TEST_CASE("Arc destroys in-place value once", "[lx::core::Arc]") {
+
+    DropCounter::drops = 0;
+    {
+        auto a = Arc<DropCounter>();
+        auto b = a;
+        a.reset();
+        REQUIRE(DropCounter::drops == 0);
+        REQUIRE(b.strong_count().unwrap() == 1);
+    }
+    REQUIRE(DropCounter::drops == 1);
+}
+
+TEST_CASE("Arc destroys derived value through base", "[lx::core::Arc]") {
+
+    DropCounter::drops = 0;
+    {
+        auto a = Arc<Base>(Arc<DropCounter>());
+        REQUIRE(a->a == 0);
+    }
+    REQUIRE(DropCounter::drops == 1);
+}
+
+TEST_CASE("Weak upgrade", "[lx::core::Weak]") {
+    auto a = Arc<TestStruct>(7);
+    auto w = a.downgrade();
+
+    REQUIRE(a.strong_count().unwrap() == 1);
+    REQUIRE(a.weak_count().unwrap() == 1);
+    REQUIRE(w.weak_count().unwrap() == 1);
+
+    auto b = w.upgrade();
+    REQUIRE(b.is_some());
+    REQUIRE(b.unwrap()->x == 7);
+    REQUIRE(a.strong_count().unwrap() == 2);
+}
+
+TEST_CASE("Weak does not keep value alive", "[lx::core::Weak]") {
+
+    DropCounter::drops = 0;
+
+    auto a = Arc<DropCounter>();
+    auto w = a.downgrade();
+    a.reset();
+
+    REQUIRE(DropCounter::drops == 1);
+    REQUIRE(w.strong_count().unwrap() == 0);
+    REQUIRE(w.weak_count().unwrap() == 1);
+    REQUIRE(w.upgrade() == None);
+
+    // The control block is released by the last Weak
+    w.reset();
+    REQUIRE(w.strong_count() == None);
+}
+
+TEST_CASE("Weak empty", "[lx::core::Weak]") {
+    auto w = Weak<TestStruct>();
+    REQUIRE(w.upgrade() == None);
+    REQUIRE(w.strong_count() == None);
+    REQUIRE(w.weak_count() == None);
+}
+
+TEST_CASE("Weak copy and move", "[lx::core::Weak]") {
+    auto a = Arc<TestStruct>(1);
+    auto w0 = a.downgrade();
+    auto w1 = w0;
+    REQUIRE(a.weak_count().unwrap() == 2);
+
+    auto w2 = std::move(w0);
+    REQUIRE(a.weak_count().unwrap() == 2);
+    REQUIRE(w0.upgrade() == None);
+    REQUIRE(w2.upgrade().unwrap()->x == 1);
+}
+
+TEST_CASE("Weak from derived", "[lx::core::Weak]") {
+    auto a = Arc<Derived>();
+    auto w = Weak<Base>(a.downgrade());
+    REQUIRE(w.upgrade().unwrap()->a == 0);
+}
+
+TEST_CASE("Weak upgrade races the last drop", "[lx::core::Weak]") {
+
+    constexpr auto rounds = 200;
+    constexpr auto threads = 4;
+
+    for (auto round = 0; round < rounds; round++) {
+        auto a = Arc<TestStruct>(round);
+        auto w = a.downgrade();
+        auto mismatches = std::atomic<i32>(0);
+
+        {
+            auto workers = std::vector<std::jthread>();
+
+            for (auto t = 0; t < threads; t++) {
+                workers.emplace_back([w, &mismatches, round] {
+                    for (auto i = 0; i < 100; i++) {
+                        auto strong = w.upgrade();
+                        if (strong.is_none()) return;
+
+                        // A successful upgrade always sees a live value
+                        if (strong.unwrap()->x != round)
+                            mismatches.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+
+            a.reset();
+        }
+
+        REQUIRE(mismatches.load() == 0);
+        REQUIRE(w.upgrade() == None);
+        REQUIRE(w.strong_count().unwrap() == 0);
+    }
+}
+
+TEST_CASE("Weak and Arc dropped concurrently", "[lx::core::Weak]") {
+
+    constexpr auto rounds = 200;
+
+    for (auto round = 0; round < rounds; round++) {
+        auto a = Arc<TestStruct>(round);
+        auto w = a.downgrade();
+
+        // Each side holds the last handle of its kind, either may free the
+        // control block
+        auto t0 = std::jthread([a = std::move(a)] mutable {
+            a.reset();
+        });
+        auto t1 = std::jthread([w = std::move(w)] mutable {
+            w.reset();
+        });
+    }
+}
+
+TEST_CASE("Arc stateful deleter", "[lx::core::Arc]") {
+    STATIC_REQUIRE(sizeof(Arc<i32, CountingDeleter>) == 2 * sizeof(void*));
+
+    auto calls = 0;
+    {
+        auto a = Arc<i32, CountingDeleter>::unsafe_from_raw(
+            new i32(1), CountingDeleter{&calls});
+        auto b = a;
+        a.reset();
+        REQUIRE(calls == 0);
+    }
+    REQUIRE(calls == 1);
+}
+
+TEST_CASE("Arc new_in frees the block through the allocator",
+          "[lx::core::Arc]") {
+    live_allocations = 0;
+    DropCounter::drops = 0;
+    {
+        auto a = Arc<DropCounter>::new_in(CountingAllocator<std::byte>());
+        REQUIRE(live_allocations == 1);
+
+        auto weak = a.downgrade();
+        a.reset();
+        REQUIRE(DropCounter::drops == 1);
+
+        // The Weak still holds the block
+        REQUIRE(live_allocations == 1);
+    }
+    REQUIRE(live_allocations == 0);
+}
+
+TEST_CASE("Arc new_in polymorphic allocator", "[lx::core::Arc]") {
+    auto buffer = std::array<std::byte, 256>();
+    auto arena = std::pmr::monotonic_buffer_resource(
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    auto a = Arc<TestStruct>::new_in(
+        std::pmr::polymorphic_allocator<std::byte>(&arena), 11);
+    auto b = a;
+    REQUIRE(b->x == 11);
+    REQUIRE(a.strong_count().unwrap() == 2);
+
+    auto* address = static_cast<const void*>(a.unsafe_get());
+    REQUIRE(address >= static_cast<const void*>(buffer.data()));
+    REQUIRE(address < static_cast<const void*>(buffer.data() + 256));
+}
+
+TEST_CASE("Arc slice shares one allocation", "[lx::core::Arc]") {
+    STATIC_REQUIRE(sizeof(Arc<u8[]>) == 2 * sizeof(void*));
+
+    const u8 response[] = {'H', 'T', 'T', 'P'};
+    auto cached = Arc<u8[]>::copy_from(response);
+    auto copy = cached;
+
+    REQUIRE(cached.len() == 4);
+    REQUIRE(copy[3] == 'P');
+    REQUIRE(copy.as_span().data() == cached.as_span().data());
+    REQUIRE(cached.strong_count().unwrap() == 2);
+
+    auto t = std::thread([shared = copy] { REQUIRE(shared[0] == 'H'); });
+    t.join();
+}
+
+TEST_CASE("Arc slice from_fn and drop", "[lx::core::Arc]") {
+    DropCounter::drops = 0;
+    {
+        auto slice = Arc<DropCounter[]>::from_fn(
+            4, [](usize) { return DropCounter(); });
+        auto copy = slice;
+        REQUIRE(copy.len() == 4);
+        DropCounter::drops = 0;
+    }
+    REQUIRE(DropCounter::drops == 4);
+
+    auto empty = Arc<u64[]>::from_fn(0, [](usize i) { return u64{i}; });
+    REQUIRE(empty.is_empty());
+    REQUIRE(static_cast<bool>(empty));
+}
+
+TEST_CASE("Arc slice get_mut fills new_uninit", "[lx::core::Arc]") {
+    auto bytes = Arc<u8[]>::new_uninit(3);
+    for (auto& b : bytes.get_mut().unwrap()) b = 0xab;
+    REQUIRE(bytes[2] == 0xab);
+
+    auto copy = bytes;
+    REQUIRE(bytes.get_mut() == None);
+
+    copy.reset();
+    bytes.get_mut().unwrap()[0] = 1;
+    REQUIRE(bytes[0] == 1);
+    REQUIRE(Arc<u8[]>().get_mut() == None);
+}
+
+TEST_CASE("Arc slice aligns its elements", "[lx::core::Arc]") {
+    struct alignas(64) Line {
+            u64 word = 0;
+    };
+
+    auto lines = Arc<Line[]>::from_fn(2, [](usize i) { return Line{i}; });
+    REQUIRE(reinterpret_cast<std::uintptr_t>(lines.unsafe_get()) % 64 == 0);
+    REQUIRE(lines[1].word == 1);
+}
+
+TEST_CASE("Arc get_mut needs a unique owner", "[lx::core::Arc]") {
+    auto a = Arc<TestStruct>(1);
+    a.get_mut().unwrap().x = 2;
+    REQUIRE(a->x == 2);
+
+    auto b = a;
+    REQUIRE(a.get_mut().is_none());
+    b.reset();
+
+    auto weak = a.downgrade();
+    REQUIRE(a.get_mut().is_none());
+    weak.reset();
+    REQUIRE(a.get_mut().is_some());
+}
+
+TEST_CASE("Arc make_mut mutates in place when unique", "[lx::core::Arc]") {
+    auto a = Arc<TestStruct>(1);
+    const auto* before = a.unsafe_get();
+
+    a.make_mut().x = 5;
+    REQUIRE(a.unsafe_get() == before);
+    REQUIRE(a->x == 5);
+}
+
+TEST_CASE("Arc make_mut copies a shared value", "[lx::core::Arc]") {
+    auto a = Arc<TestStruct>(1);
+    auto snapshot = a;
+
+    a.make_mut().x = 9;
+    REQUIRE(a->x == 9);
+    REQUIRE(snapshot->x == 1);
+    REQUIRE(!Arc<TestStruct>::ptr_eq(a, snapshot));
+    REQUIRE(a.strong_count().unwrap() == 1);
+
+    // Now unique: the next update stays in place
+    const auto* copy = a.unsafe_get();
+    a.make_mut().x = 10;
+    REQUIRE(a.unsafe_get() == copy);
+}
+
+TEST_CASE("Arc try_unwrap", "[lx::core::Arc]") {
+    auto a = Arc<TestStruct>(3);
+    auto b = a;
+
+    auto shared = std::move(a).try_unwrap();
+    REQUIRE(shared.is_err());
+    a = std::move(shared).unwrap_err();
+    REQUIRE(Arc<TestStruct>::ptr_eq(a, b));
+
+    auto weak = a.downgrade();
+    b.reset();
+    auto unique = std::move(a).try_unwrap();
+    REQUIRE(unique.is_ok());
+    REQUIRE(unique.unwrap().x == 3);
+    REQUIRE(weak.upgrade().is_none());
+}
+
+TEST_CASE("Arc make_mut copies into the original allocator",
+          "[lx::core::Arc]") {
+    struct Tagged : Base, TestStruct {};
+
+    auto buffer = std::array<std::byte, 256>();
+    auto arena = std::pmr::monotonic_buffer_resource(
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    auto in_arena = [&](const void* address) {
+        return address >= static_cast<const void*>(buffer.data()) &&
+               address < static_cast<const void*>(buffer.data() + 256);
+    };
+
+    auto a = Arc<TestStruct>(Arc<Tagged>::new_in(
+        std::pmr::polymorphic_allocator<std::byte>(&arena)));
+    auto snapshot = a;
+
+    a.make_mut().x = 4;
+    REQUIRE(!Arc<TestStruct>::ptr_eq(a, snapshot));
+    REQUIRE(in_arena(a.unsafe_get()));
+    REQUIRE(a->x == 4);
+    REQUIRE(snapshot->x == 0);
+
+    live_allocations = 0;
+    {
+        auto b = Arc<TestStruct>::new_in(CountingAllocator<std::byte>(), 1);
+        auto c = b;
+        b.make_mut().x = 2;
+        REQUIRE(live_allocations == 2);
+        REQUIRE(c->x == 1);
+    }
+    REQUIRE(live_allocations == 0);
+}
+
+TEST_CASE("Arc make_mut copies the derived object", "[lx::core::Arc]") {
+    DropCounter::drops = 0;
+    {
+        auto a = Arc<Base>(Arc<DropCounter>());
+        auto snapshot = a;
+
+        a.make_mut().a = 3;
+        REQUIRE(!Arc<Base>::ptr_eq(a, snapshot));
+        REQUIRE(a->a == 3);
+        REQUIRE(snapshot->a == 0);
+    }
+
+    // A sliced copy would be a plain Base and never count its drop
+    REQUIRE(DropCounter::drops == 2);
+}
+
+TEST_CASE("Arc make_mut keeps a stateful deleter", "[lx::core::Arc]") {
+    auto calls = 0;
+    {
+        auto a = Arc<i32, CountingDeleter>::unsafe_from_raw(
+            new i32(1), CountingDeleter{&calls});
+        auto snapshot = a;
+
+        a.make_mut() = 2;
+        REQUIRE(*snapshot == 1);
+    }
+    REQUIRE(calls == 2);
+}
+
+TEST_CASE("Arc try_unwrap gives an empty Arc back", "[lx::core::Arc]") {
+    auto empty = Arc<TestStruct>();
+    auto result = std::move(empty).try_unwrap();
+    REQUIRE(result.is_err());
+    REQUIRE(!std::move(result).unwrap_err());
+}
+
+TEST_CASE("Arc try_unwrap destroys the moved-from value", "[lx::core::Arc]") {
+    DropCounter::drops = 0;
+    {
+        auto a = Arc<DropCounter>();
+        auto value = std::move(a).try_unwrap();
+        REQUIRE(value.is_ok());
+        REQUIRE(DropCounter::drops == 1);
+    }
+    REQUIRE(DropCounter::drops == 2);
+}
+
+TEST_CASE("Arc is_unique races downgrade", "[lx::core::Arc]") {
+    auto a = Arc<TestStruct>(0);
+
+    for (auto round = 0; round < 1000; round++) {
+        auto b = a;
+        auto t = std::thread([b = std::move(b)]() mutable {
+            auto weak = b.downgrade();
+            b.reset();
+        });
+
+        // May or may not see the other handles, but must leave the weak
+        // count intact for the downgrade running next to it
+        (void)a.get_mut();
+        t.join();
+        REQUIRE(a.get_mut().is_some());
+    }
+}
@@ -0,0 +1,146 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/arena.hpp"
+#include "lastix/core/box.hpp"
+#include "memory_helpers.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+namespace {
+
+    struct alignas(64) Wide {
+            u64 words[2] = {};
+    };
+
+    auto aligned_to(const void* ptr, usize align) -> bool {
+        return reinterpret_cast<std::uintptr_t>(ptr) % align == 0;
+    }
+
+}; // namespace
+
+TEST_CASE("Arena aligns allocations", "[lx::core::Arena]") {
+    auto arena = Arena();
+
+    auto* byte = arena.allocate(1, 1).unwrap();
+    auto* wide = arena.create<Wide>().unwrap();
+    auto* word = arena.create<u64>(u64{7}).unwrap();
+
+    REQUIRE(byte != nullptr);
+    REQUIRE(aligned_to(wide, 64));
+    REQUIRE(aligned_to(word, alignof(u64)));
+    REQUIRE(*word == 7);
+}
+
+TEST_CASE("Arena chains chunks", "[lx::core::Arena]") {
+    auto arena = Arena(128);
+
+    auto* first = arena.create<u64>(u64{1}).unwrap();
+    for (auto i = u64{0}; i < 100; i++)
+        REQUIRE(*arena.create<u64>(i).unwrap() == i);
+
+    // Larger than a chunk: gets a chunk of its own
+    auto* large = arena.allocate(1000, 8).unwrap();
+    REQUIRE(large != nullptr);
+
+    REQUIRE(*first == 1);
+    REQUIRE(arena.capacity() >= 1000 + 800);
+}
+
+TEST_CASE("Arena reset reuses its chunks", "[lx::core::Arena]") {
+    auto arena = Arena(256);
+
+    auto* first = arena.allocate(16, 8).unwrap();
+    for (auto i = 0; i < 50; i++) (void)arena.allocate(16, 8).unwrap();
+    auto capacity = arena.capacity();
+
+    arena.reset();
+    REQUIRE(arena.allocate(16, 8).unwrap() == first);
+    for (auto i = 0; i < 50; i++) (void)arena.allocate(16, 8).unwrap();
+    REQUIRE(arena.capacity() == capacity);
+}
+
+TEST_CASE("Arena rewind to a mark", "[lx::core::Arena]") {
+    auto arena = Arena(64);
+    (void)arena.allocate(8, 8).unwrap();
+
+    auto mark = arena.mark();
+    auto* after_mark = arena.allocate(8, 8).unwrap();
+    for (auto i = 0; i < 20; i++) (void)arena.allocate(8, 8).unwrap();
+
+    arena.rewind(mark);
+    REQUIRE(arena.allocate(8, 8).unwrap() == after_mark);
+
+    // A mark taken before the first allocation rewinds everything
+    auto empty = Arena();
+    auto start = empty.mark();
+    auto* a = empty.allocate(8, 8).unwrap();
+    empty.rewind(start);
+    REQUIRE(empty.allocate(8, 8).unwrap() == a);
+}
+
+TEST_CASE("Arena reports exhaustion as an error", "[lx::core::Arena]") {
+    auto arena = Arena(64, 128);
+
+    REQUIRE(arena.allocate(64, 1).is_ok());
+    REQUIRE(arena.allocate(64, 1).is_ok());
+
+    auto r = arena.create<Wide>();
+    REQUIRE(r.is_err());
+    REQUIRE(r.unwrap_err().what() == "Arena is out of memory");
+    REQUIRE(arena.make<i32>(1).is_err());
+}
+
+TEST_CASE("Arena rejects sizes that wrap the address space",
+          "[lx::core::Arena]") {
+    auto arena = Arena();
+    REQUIRE(arena.allocate(8, 8).is_ok());
+
+    for (auto k : {usize{0}, usize{1}, usize{8}, usize{4096}}) {
+        auto r = arena.allocate(std::numeric_limits<usize>::max() - k, 8);
+        REQUIRE(r.is_err());
+        REQUIRE(r.unwrap_err().what() == "Arena is out of memory");
+    }
+
+    // The cursor was left alone
+    auto* word = arena.create<u64>(u64{3}).unwrap();
+    REQUIRE(aligned_to(word, alignof(u64)));
+    REQUIRE(*word == 3);
+}
+
+TEST_CASE("ArenaBox runs the destructor only", "[lx::core::ArenaBox]") {
+    auto arena = Arena();
+    DropCounter::drops = 0;
+    {
+        auto a = arena.make<DropCounter>().unwrap();
+        auto b = std::move(a);
+        REQUIRE(!static_cast<bool>(a));
+        REQUIRE(b->a == 0);
+    }
+    REQUIRE(DropCounter::drops == 1);
+
+    auto kept = arena.make<DropCounter>().unwrap();
+    auto* raw = kept.release();
+    REQUIRE(DropCounter::drops == 1);
+    std::destroy_at(raw);
+}
+
+TEST_CASE("Box in an Arena", "[lx::core::Arena]") {
+    auto arena = Arena();
+    auto mark = arena.mark();
+    {
+        auto box = Box<TestStruct>::new_in(ArenaAllocator<TestStruct>(arena),
+                                           5);
+        REQUIRE(box->x == 5);
+    }
+    arena.rewind(mark);
+}
+
+TEST_CASE("Arena for_thread is per thread", "[lx::core::Arena]") {
+    auto* main_arena = &Arena::for_thread();
+    REQUIRE(main_arena == &Arena::for_thread());
+
+    auto* other_arena = static_cast<Arena*>(nullptr);
+    std::thread([&] { other_arena = &Arena::for_thread(); }).join();
+    REQUIRE(other_arena != main_arena);
+}
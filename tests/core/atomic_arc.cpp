@@ -0,0 +1,193 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/atomic_arc.hpp"
+#include "memory_helpers.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+    /// TestStruct sits after the vtable pointer of Base, not at offset 0.
+    struct Offset : Base, TestStruct {
+            explicit Offset(i32 value = 0) noexcept {
+                x = value;
+            }
+    };
+
+    template <class T>
+    using LockedSlot =
+        lx::core::impl::AtomicArcSlot<T, DefaultDeleter<T>, false>;
+
+}; // namespace
+
+TEST_CASE("AtomicArc load and store", "[lx::core::AtomicArc]") {
+    auto slot = AtomicArc(Arc<TestStruct>(1));
+    REQUIRE(slot.load()->x == 1);
+
+    slot.store(Arc<TestStruct>(2));
+    auto loaded = slot.load();
+    REQUIRE(loaded->x == 2);
+
+    // The loaded snapshot outlives the value being replaced
+    slot.store(Arc<TestStruct>(3));
+    REQUIRE(loaded->x == 2);
+    REQUIRE(loaded.strong_count().unwrap() == 1);
+    REQUIRE(slot.load()->x == 3);
+}
+
+TEST_CASE("AtomicArc drops stored values", "[lx::core::AtomicArc]") {
+    DropCounter::drops = 0;
+    {
+        auto slot = AtomicArc(Arc<DropCounter>());
+        for (auto i = 0; i < 10; i++) {
+            auto loaded = slot.load();
+        }
+        slot.store(Arc<DropCounter>());
+        REQUIRE(DropCounter::drops == 1);
+    }
+    REQUIRE(DropCounter::drops == 2);
+}
+
+TEST_CASE("AtomicArc exchange", "[lx::core::AtomicArc]") {
+    auto slot = AtomicArc(Arc<TestStruct>(1));
+    auto a = slot.load();
+
+    auto previous = slot.exchange(Arc<TestStruct>(2));
+    REQUIRE(previous.unsafe_get() == a.unsafe_get());
+    REQUIRE(previous.strong_count().unwrap() == 2);
+    REQUIRE(slot.load()->x == 2);
+}
+
+TEST_CASE("AtomicArc compare_exchange", "[lx::core::AtomicArc]") {
+    auto slot = AtomicArc(Arc<TestStruct>(1));
+    auto expected = slot.load();
+
+    REQUIRE(slot.compare_exchange(expected, Arc<TestStruct>(2)));
+    REQUIRE(slot.load()->x == 2);
+
+    // expected still points at the old value, so this one fails and
+    // reports the current value
+    REQUIRE(!slot.compare_exchange(expected, Arc<TestStruct>(3)));
+    REQUIRE(expected->x == 2);
+    REQUIRE(slot.compare_exchange(expected, Arc<TestStruct>(3)));
+    REQUIRE(slot.load()->x == 3);
+}
+
+TEST_CASE("AtomicArc refills pre-paid references", "[lx::core::AtomicArc]") {
+    auto arc = Arc<TestStruct>(7);
+    auto slot = AtomicArc(arc);
+    auto held = std::vector<Arc<TestStruct>>();
+
+    // Enough loads to go through several refills, half of them kept alive
+    for (auto i = 0; i < 300'000; i++) {
+        auto loaded = slot.load();
+        REQUIRE(loaded.unsafe_get() == arc.unsafe_get());
+        if (i % 2 == 0) held.push_back(std::move(loaded));
+    }
+
+    held.clear();
+    slot.store(Arc<TestStruct>(8));
+    REQUIRE(arc.strong_count().unwrap() == 1);
+}
+
+TEST_CASE("AtomicArc concurrent readers and writer", "[lx::core::AtomicArc]") {
+
+    constexpr auto readers = 4;
+    constexpr auto rounds = 20'000;
+
+    auto slot = AtomicArc(Arc<TestStruct>(0));
+    auto mismatches = std::atomic<i32>(0);
+    auto done = std::atomic<bool>(false);
+
+    {
+        auto workers = std::vector<std::jthread>();
+
+        for (auto t = 0; t < readers; t++) {
+            workers.emplace_back([&] {
+                auto last = 0;
+                while (!done.load(std::memory_order_relaxed)) {
+                    auto x = slot.load()->x;
+
+                    // Values only ever grow
+                    if (x < last)
+                        mismatches.fetch_add(1, std::memory_order_relaxed);
+                    last = x;
+                }
+            });
+        }
+
+        for (auto i = 1; i <= rounds; i++)
+            slot.store(Arc<TestStruct>(i));
+
+        done.store(true);
+    }
+
+    REQUIRE(mismatches.load() == 0);
+    REQUIRE(slot.load()->x == rounds);
+    REQUIRE(slot.load().strong_count().unwrap() > 1);
+}
+
+TEST_CASE("AtomicArc stores Arcs to base subobjects", "[lx::core::AtomicArc]") {
+    auto derived = Arc<Offset>(3);
+
+    auto base = Arc<TestStruct>(Arc<Offset>(derived));
+    REQUIRE(static_cast<const void*>(base.unsafe_get()) !=
+            static_cast<const void*>(derived.unsafe_get()));
+
+    auto slot = AtomicArc(base);
+    REQUIRE(slot.load().unsafe_get() == base.unsafe_get());
+    REQUIRE(slot.load()->x == 3);
+
+    auto expected = slot.load();
+    REQUIRE(slot.compare_exchange(expected, Arc<TestStruct>(4)));
+    REQUIRE(slot.load()->x == 4);
+
+    auto previous = slot.exchange(base);
+    REQUIRE(previous->x == 4);
+    REQUIRE(!slot.compare_exchange(previous, Arc<TestStruct>(5)));
+    REQUIRE(previous.unsafe_get() == base.unsafe_get());
+
+    // Only derived and base are left once the slot lets go
+    expected.reset();
+    previous.reset();
+    slot.store(Arc<TestStruct>(6));
+    REQUIRE(base.strong_count().unwrap() == 2);
+}
+
+TEST_CASE("AtomicArc locked fallback slot", "[lx::core::AtomicArc]") {
+    auto slot = LockedSlot<TestStruct>(Arc<TestStruct>(1));
+    auto first = slot.load();
+    REQUIRE(first->x == 1);
+    REQUIRE(first.strong_count().unwrap() == 2);
+
+    slot.store(Arc<TestStruct>(2));
+    REQUIRE(first.strong_count().unwrap() == 1);
+
+    auto expected = first;
+    REQUIRE(!slot.compare_exchange(expected, Arc<TestStruct>(3)));
+    REQUIRE(expected->x == 2);
+    REQUIRE(slot.compare_exchange(expected, Arc<TestStruct>(3)));
+    REQUIRE(slot.exchange(Arc<TestStruct>(4))->x == 3);
+
+    auto derived = Arc<Offset>();
+    auto empty = LockedSlot<TestStruct>(LockedSlot<TestStruct>::null());
+    REQUIRE(!empty.load());
+    empty.store(Arc<TestStruct>(std::move(derived)));
+    REQUIRE(empty.load()->x == 0);
+}
+
+TEST_CASE("AtomicOption of Arc", "[lx::core::AtomicOption]") {
+    auto slot = AtomicOption<Arc<TestStruct>>(None);
+    REQUIRE(slot.load() == None);
+
+    slot.store(Some(Arc<TestStruct>(5)));
+    REQUIRE(slot.load().unwrap()->x == 5);
+
+    auto taken = slot.take();
+    REQUIRE(taken.unwrap()->x == 5);
+    REQUIRE(slot.load() == None);
+
+    auto previous = slot.exchange(Some(Arc<TestStruct>(6)));
+    REQUIRE(previous == None);
+    REQUIRE(slot.load().unwrap()->x == 6);
+}
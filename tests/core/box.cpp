@@ -3,6 +3,18 @@
 #include "lastix/core/number.hpp"
 #include "memory_helpers.hpp"
 
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+
+template <class Slice>
+concept BuildsSlices = requires {
+    Slice::new_uninit(usize{1});
+    Slice::from_fn(usize{1}, [](usize) { return i32{0}; });
+};
+
 TEST_CASE("Box basic construction", "[lx::core::Box]") {
     auto ptr = Box<TestStruct>(42);
     REQUIRE(ptr->x == 42);
@@ -22,6 +34,21 @@ TEST_CASE("Box move from derived", "[lx::core::Box]") {
     auto b = Box<Base>(std::move(a));
     REQUIRE(!static_cast<bool>(a));
     REQUIRE(b->a == 0);
+
+    b = Box<Derived>();
+    REQUIRE(b->a == 0);
+}
+
+TEST_CASE("Box from derived keeps the deleter that matches new",
+          "[lx::core::Box]") {
+    using AllocBase =
+        Box<Base, AllocatorDeleter<Base, CountingAllocator<Base>>>;
+    using DeleterBase = Box<Base, FlagDeleter>;
+
+    STATIC_REQUIRE(std::constructible_from<Box<Base>, Box<Derived> &&>);
+    STATIC_REQUIRE(!std::constructible_from<AllocBase, Box<Derived> &&>);
+    STATIC_REQUIRE(!std::is_assignable_v<AllocBase &, Box<Derived> &&>);
+    STATIC_REQUIRE(!std::constructible_from<DeleterBase, Box<Derived> &&>);
 }
 
 TEST_CASE("Box swap", "[lx::core::Box]") {
@@ -71,3 +98,111 @@ TEST_CASE("Box release", "[lx::core::Box]") {
     REQUIRE(!FlagDeleter::deleted);
     delete raw;
 }
+
+TEST_CASE("Box keeps a stateless deleter out of its size", "[lx::core::Box]") {
+    STATIC_REQUIRE(sizeof(Box<i32>) == sizeof(void*));
+    STATIC_REQUIRE(sizeof(Box<i32, FlagDeleter>) == sizeof(void*));
+    STATIC_REQUIRE(
+        sizeof(Box<i32, AllocatorDeleter<i32, CountingAllocator<i32>>>) ==
+        sizeof(void*));
+}
+
+TEST_CASE("Box stateful deleter", "[lx::core::Box]") {
+    auto calls = 0;
+    {
+        auto a = Box<i32, CountingDeleter>::unsafe_from_raw(
+            new i32(1), CountingDeleter{&calls});
+        auto b = std::move(a);
+        a.reset();
+        REQUIRE(calls == 0);
+    }
+    REQUIRE(calls == 1);
+}
+
+TEST_CASE("Box new_in static allocator", "[lx::core::Box]") {
+    live_allocations = 0;
+    {
+        auto box = Box<TestStruct>::new_in(CountingAllocator<std::byte>(), 9);
+        REQUIRE(box->x == 9);
+        REQUIRE(live_allocations == 1);
+
+        auto moved = std::move(box);
+        REQUIRE(live_allocations == 1);
+    }
+    REQUIRE(live_allocations == 0);
+}
+
+TEST_CASE("Box new_in polymorphic allocator", "[lx::core::Box]") {
+    auto buffer = std::array<std::byte, 256>();
+    auto arena = std::pmr::monotonic_buffer_resource(
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    auto box = Box<TestStruct>::new_in(
+        std::pmr::polymorphic_allocator<std::byte>(&arena), 3);
+    REQUIRE(box->x == 3);
+
+    auto* address = static_cast<const void*>(box.unsafe_get());
+    REQUIRE(address >= static_cast<const void*>(buffer.data()));
+    REQUIRE(address < static_cast<const void*>(buffer.data() + 256));
+}
+
+TEST_CASE("Box slice from_fn", "[lx::core::Box]") {
+    auto squares = Box<u64[]>::from_fn(5, [](usize i) { return u64{i * i}; });
+    REQUIRE(squares.len() == 5);
+    REQUIRE(squares[4] == 16);
+
+    squares[0] = 7;
+    auto span = std::span<const u64>(squares);
+    REQUIRE(span.size() == 5);
+    REQUIRE(span[0] == 7);
+    REQUIRE(sizeof(squares) == 2 * sizeof(void*));
+}
+
+TEST_CASE("Box slice new_uninit and copy_from", "[lx::core::Box]") {
+    auto bytes = Box<u8[]>::new_uninit(3);
+    for (auto& b : bytes.as_span()) b = 0xab;
+    REQUIRE(bytes[2] == 0xab);
+
+    const u8 source[] = {1, 2, 3, 4};
+    auto copy = Box<u8[]>::copy_from(source);
+    REQUIRE(copy.len() == 4);
+    REQUIRE(copy[3] == 4);
+
+    auto moved = std::move(copy);
+    REQUIRE(copy.is_empty());
+    REQUIRE(moved.len() == 4);
+
+    auto released = moved.release();
+    REQUIRE(released.size() == 4);
+    DefaultDeleter<u8[]>()(released.data(), released.size());
+}
+
+TEST_CASE("Box slice builds elements in place", "[lx::core::Box]") {
+    struct Id {
+            explicit Id(usize value) noexcept : value(value) {
+            }
+
+            usize value;
+    };
+
+    STATIC_REQUIRE(!std::default_initializable<Id>);
+
+    auto ids = Box<Id[]>::from_fn(3, [](usize i) { return Id(i + 1); });
+    REQUIRE(ids.len() == 3);
+    REQUIRE(ids[2].value == 3);
+
+    // Only the default deleter frees what these allocate
+    STATIC_REQUIRE(BuildsSlices<Box<i32[]>>);
+    STATIC_REQUIRE(!BuildsSlices<Box<i32[], FlagDeleter>>);
+}
+
+TEST_CASE("Box slice destroys every element", "[lx::core::Box]") {
+    DropCounter::drops = 0;
+    {
+        auto slice = Box<DropCounter[]>::from_fn(
+            3, [](usize) { return DropCounter(); });
+        REQUIRE(slice.len() == 3);
+        DropCounter::drops = 0;
+    }
+    REQUIRE(DropCounter::drops == 3);
+}
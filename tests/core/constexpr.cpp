@@ -0,0 +1,214 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/core/result.hpp"
+
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+using namespace lx::core;
+
+namespace {
+
+    /// F() is a constant expression: it does not reach a panic.
+    template <auto F>
+    concept ConstantEvaluable = requires {
+        typename std::bool_constant<(static_cast<void>(F()), true)>;
+    };
+
+    enum class ConfigError { missing_key, bad_number, out_of_range };
+
+    struct Config {
+            u16 port;
+            u8 workers;
+
+            auto operator==(const Config&) const -> bool = default;
+    };
+
+    constexpr auto hex_digit(char c) noexcept -> Option<u8> {
+
+        if (c >= '0' && c <= '9') return Some(static_cast<u8>(c - '0'));
+        if (c >= 'a' && c <= 'f') return Some(static_cast<u8>(c - 'a' + 10));
+
+        return None;
+    }
+
+    /// Filled by the compiler; 0xff marks characters that are not digits.
+    constexpr auto hex_table = [] {
+        auto table = std::array<u8, 128>{};
+
+        for (auto c = usize{0}; c < table.size(); c++)
+            table[c] = hex_digit(static_cast<char>(c)).unwrap_or(0xff);
+
+        return table;
+    }();
+
+    constexpr auto parse_number(std::string_view text) noexcept
+        -> Result<u32, ConfigError> {
+
+        // Nine digits always fit in a u32
+        if (text.empty() || text.size() > 9)
+            return Err(ConfigError::bad_number);
+
+        auto value = u32{0};
+        for (auto c : text) {
+            if (c < '0' || c > '9') return Err(ConfigError::bad_number);
+            value = value * 10 + static_cast<u32>(c - '0');
+        }
+
+        return Ok(value);
+    }
+
+    /// The value of `key` in "key=value;key=value".
+    constexpr auto find(std::string_view config, std::string_view key) noexcept
+        -> Option<std::string_view> {
+
+        while (!config.empty()) {
+            auto end = config.find(';');
+            auto entry = config.substr(0, end);
+            auto eq = entry.find('=');
+
+            if (eq != std::string_view::npos && entry.substr(0, eq) == key)
+                return Some(entry.substr(eq + 1));
+
+            if (end == std::string_view::npos) break;
+            config.remove_prefix(end + 1);
+        }
+
+        return None;
+    }
+
+    constexpr auto field(std::string_view config, std::string_view key,
+                         u32 max) noexcept -> Result<u32, ConfigError> {
+
+        auto text = find(config, key);
+        if (text.is_none()) return Err(ConfigError::missing_key);
+
+        return parse_number(text.unwrap())
+            .and_then([&](u32 n) -> Result<u32, ConfigError> {
+                if (n > max) return Err(ConfigError::out_of_range);
+                return Ok(n);
+            });
+    }
+
+    constexpr auto parse_config(std::string_view text) noexcept
+        -> Result<Config, ConfigError> {
+
+        auto port = field(text, "port", 65535);
+        if (port.is_err()) return Err(port.unwrap_err());
+
+        auto workers = field(text, "workers", 255)
+                           .or_else([](ConfigError e)
+                                        -> Result<u32, ConfigError> {
+                               if (e == ConfigError::missing_key) return Ok(1u);
+                               return Err(e);
+                           });
+        if (workers.is_err()) return Err(workers.unwrap_err());
+
+        return Ok(Config{static_cast<u16>(port.unwrap()),
+                         static_cast<u8>(workers.unwrap())});
+    }
+
+    constexpr auto static_config = parse_config("port=8080;workers=4");
+
+}; // namespace
+
+TEST_CASE("Option in constant expressions", "[lx::core::Option]") {
+    STATIC_REQUIRE(Option<i32>(Some(3)).unwrap() == 3);
+    STATIC_REQUIRE(Option<i32>(None).is_none());
+    STATIC_REQUIRE(Option<i32>(None).unwrap_or(7) == 7);
+    STATIC_REQUIRE(Option<i32>(Some(3)) == Option<i32>(Some(3)));
+    STATIC_REQUIRE(Option<i32>(None) == None);
+
+    STATIC_REQUIRE(
+        Option<i32>(Some(2)).map([](i32 v) { return v * 2; }).unwrap() == 4);
+    STATIC_REQUIRE(Option<i32>(Some(2))
+                       .and_then([](i32) -> Option<i32> { return None; })
+                       .is_none());
+    STATIC_REQUIRE(Option<Option<i32>>(Some(Option<i32>(Some(5))))
+                       .flatten()
+                       .unwrap() == 5);
+
+    STATIC_REQUIRE([] {
+        auto o = Option<i32>(Some(1));
+        auto old = o.replace(5);
+        auto taken = o.take();
+        return old.unwrap() == 1 && taken.unwrap() == 5 && o.is_none();
+    }());
+
+    STATIC_REQUIRE([] {
+        auto value = 9;
+        auto o = Option<i32&>(Some<i32&>(value));
+        o.unwrap() = 10;
+        return value;
+    }() == 10);
+}
+
+TEST_CASE("Result in constant expressions", "[lx::core::Result]") {
+    using R = Result<i32, ConfigError>;
+
+    STATIC_REQUIRE(R(Ok(4)).is_ok());
+    STATIC_REQUIRE(R(Ok(4)).unwrap() == 4);
+    STATIC_REQUIRE(R(Err(ConfigError::bad_number)).unwrap_err() ==
+                   ConfigError::bad_number);
+    STATIC_REQUIRE(R(Err(ConfigError::bad_number)).unwrap_or(-1) == -1);
+    STATIC_REQUIRE(R(Ok(4)) == R(Ok(4)));
+    STATIC_REQUIRE(R(Ok(4)).ok().unwrap() == 4);
+    STATIC_REQUIRE(R(Ok(4)).err().is_none());
+
+    STATIC_REQUIRE(R(Ok(4)).map([](i32 v) { return v + 1; }).unwrap() == 5);
+    STATIC_REQUIRE(R(Err(ConfigError::missing_key))
+                       .map_err([](ConfigError) { return 7; })
+                       .unwrap_err() == 7);
+    STATIC_REQUIRE(R(Ok(4)).match([](i32 v) { return v; },
+                                  [](ConfigError) { return 0; }) == 4);
+
+    STATIC_REQUIRE(Result<void, ConfigError>(Ok()).is_ok());
+    STATIC_REQUIRE(Option<R>(Some(R(Ok(4)))).transpose().unwrap().unwrap() ==
+                   4);
+}
+
+TEST_CASE("Lookup tables built at compile time", "[lx::core::Option]") {
+    STATIC_REQUIRE(hex_table['7'] == 7);
+    STATIC_REQUIRE(hex_table['c'] == 12);
+    STATIC_REQUIRE(hex_table['x'] == 0xff);
+}
+
+TEST_CASE("Static config parsed at compile time", "[lx::core::Result]") {
+    STATIC_REQUIRE(static_config.unwrap() == Config{8080, 4});
+    STATIC_REQUIRE(parse_config("port=80").unwrap() == Config{80, 1});
+
+    STATIC_REQUIRE(parse_config("workers=4").unwrap_err() ==
+                   ConfigError::missing_key);
+    STATIC_REQUIRE(parse_config("port=80x").unwrap_err() ==
+                   ConfigError::bad_number);
+    STATIC_REQUIRE(parse_config("port=70000").unwrap_err() ==
+                   ConfigError::out_of_range);
+    STATIC_REQUIRE(parse_config("port=80;workers=300").unwrap_err() ==
+                   ConfigError::out_of_range);
+
+    // The same parser still runs on strings only known at run time
+    auto text = std::string_view("workers=2;port=443");
+    REQUIRE(parse_config(text).unwrap() == Config{443, 2});
+}
+
+TEST_CASE("Panics are not constant expressions", "[lx::core::Result]") {
+    STATIC_REQUIRE(ConstantEvaluable<[] {
+        return Option<i32>(Some(1)).unwrap();
+    }>);
+    STATIC_REQUIRE(!ConstantEvaluable<[] {
+        return Option<i32>(None).unwrap();
+    }>);
+
+    STATIC_REQUIRE(ConstantEvaluable<[] {
+        return Result<i32, ConfigError>(Ok(1)).unwrap();
+    }>);
+    STATIC_REQUIRE(!ConstantEvaluable<[] {
+        return Result<i32, ConfigError>(Err(ConfigError::bad_number))
+            .unwrap();
+    }>);
+    STATIC_REQUIRE(!ConstantEvaluable<[] {
+        return Result<i32, ConfigError>(Ok(1)).unwrap_err();
+    }>);
+}
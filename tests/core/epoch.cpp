@@ -0,0 +1,196 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/epoch.hpp"
+#include "memory_helpers.hpp"
+
+#include <atomic>
+#include <latch>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    /// Enough collections for the epoch to move past anything retired.
+    auto collect_all() -> void {
+        for (auto i = 0; i < 4; i++) Epoch::collect();
+    }
+
+    struct Node {
+            u64 value;
+            Node* next;
+    };
+
+    /// Treiber stack that frees popped nodes through Epoch.
+    class Stack {
+
+        public:
+            ~Stack() {
+                while (auto* node = _head.load()) {
+                    _head.store(node->next);
+                    delete node;
+                }
+            }
+
+            auto push(u64 value) -> void {
+                auto* node = new Node{value, _head.load()};
+                while (!_head.compare_exchange_weak(node->next, node)) {
+                }
+            }
+
+            auto pop() -> bool {
+                auto guard = Epoch::pin();
+                auto* node = _head.load(std::memory_order_acquire);
+
+                while (node != nullptr &&
+                       !_head.compare_exchange_weak(node, node->next)) {
+                }
+
+                if (node == nullptr) return false;
+
+                guard.retire(node);
+                return true;
+            }
+
+        private:
+            std::atomic<Node*> _head = nullptr;
+    };
+
+}; // namespace
+
+TEST_CASE("Epoch reclaims once nobody is pinned", "[lx::core::Epoch]") {
+    DropCounter::drops = 0;
+    {
+        auto guard = Epoch::pin();
+        guard.retire(new DropCounter());
+        guard.flush();
+        REQUIRE(DropCounter::drops == 0);
+    }
+
+    collect_all();
+    REQUIRE(DropCounter::drops == 1);
+    REQUIRE(Epoch::pending() == 0);
+}
+
+TEST_CASE("Epoch waits for a pinned reader", "[lx::core::Epoch]") {
+    DropCounter::drops = 0;
+
+    auto pinned = std::latch(1);
+    auto release = std::latch(1);
+    auto reader = std::thread([&] {
+        auto guard = Epoch::pin();
+        pinned.count_down();
+        release.wait();
+    });
+    pinned.wait();
+
+    Epoch::pin().retire(new DropCounter());
+    collect_all();
+    REQUIRE(DropCounter::drops == 0);
+
+    release.count_down();
+    reader.join();
+    collect_all();
+    REQUIRE(DropCounter::drops == 1);
+}
+
+TEST_CASE("Epoch guards nest", "[lx::core::Epoch]") {
+    DropCounter::drops = 0;
+    {
+        auto outer = Epoch::pin();
+        {
+            auto inner = Epoch::pin();
+            inner.retire(new DropCounter());
+        }
+
+        // Still pinned by the outer guard
+        collect_all();
+        REQUIRE(DropCounter::drops == 0);
+    }
+
+    collect_all();
+    REQUIRE(DropCounter::drops == 1);
+}
+
+TEST_CASE("Epoch custom deleter", "[lx::core::Epoch]") {
+    FlagDeleter::deleted = false;
+    Epoch::pin().retire<i32, FlagDeleter>(new i32(3));
+
+    collect_all();
+    REQUIRE(FlagDeleter::deleted);
+}
+
+TEST_CASE("Epoch adopts retire lists of exited threads",
+          "[lx::core::Epoch]") {
+    auto dropped = std::atomic<i32>(0);
+
+    struct Tracked {
+            std::atomic<i32>* dropped;
+
+            ~Tracked() {
+                dropped->fetch_add(1);
+            }
+    };
+
+    auto blocker_pinned = std::latch(1);
+    auto blocker_release = std::latch(1);
+    auto blocker = std::thread([&] {
+        auto guard = Epoch::pin();
+        blocker_pinned.count_down();
+        blocker_release.wait();
+    });
+    blocker_pinned.wait();
+
+    // Cannot be reclaimed before the thread exits
+    std::thread([&] { Epoch::pin().retire(new Tracked{&dropped}); }).join();
+    REQUIRE(dropped.load() == 0);
+
+    blocker_release.count_down();
+    blocker.join();
+    collect_all();
+    REQUIRE(dropped.load() == 1);
+}
+
+TEST_CASE("Epoch flush drops what joined threads retired",
+          "[lx::core::Epoch]") {
+    auto dropped = std::atomic<i32>(0);
+
+    struct Tracked {
+            std::atomic<i32>* dropped;
+
+            ~Tracked() {
+                dropped->fetch_add(1);
+            }
+    };
+
+    for (auto t = 0; t < 3; t++) {
+        std::thread([&] {
+            auto guard = Epoch::pin();
+            for (auto i = 0; i < 10; i++) guard.retire(new Tracked{&dropped});
+        }).join();
+    }
+
+    Epoch::pin().retire(new Tracked{&dropped});
+
+    Epoch::flush();
+    REQUIRE(dropped.load() == 31);
+    REQUIRE(Epoch::pending() == 0);
+}
+
+TEST_CASE("Epoch protects a lock-free stack", "[lx::core::Epoch]") {
+    auto stack = Stack();
+    auto popped = std::atomic<u64>(0);
+    auto threads = std::vector<std::thread>();
+
+    for (auto t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            for (auto i = u64{0}; i < 2000; i++) {
+                stack.push(i);
+                if (stack.pop()) popped.fetch_add(1);
+            }
+            Epoch::collect();
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+    collect_all();
+    REQUIRE(popped.load() == 8000);
+}
@@ -0,0 +1,335 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/arena.hpp"
+#include "lastix/core/error.hpp"
+#include "lastix/core/result.hpp"
+
+#include <array>
+#include <format>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace lx::core;
+
+namespace {
+
+    constexpr char not_found[] = "File not found";
+
+    struct ParseError {
+            usize line;
+            usize column;
+
+            auto what() const noexcept -> std::string_view {
+                return "unexpected token";
+            }
+    };
+
+    /// Too large for the inline buffer, counts its drops.
+    struct LargeError {
+            std::array<u64, 8> words;
+            i32* drops;
+
+            LargeError(i32* d) noexcept : words{}, drops(d) {
+            }
+
+            LargeError(LargeError&& other) noexcept
+                : words(other.words),
+                  drops(std::exchange(other.drops, nullptr)) {
+            }
+
+            ~LargeError() noexcept {
+                if (drops != nullptr) *drops += 1;
+            }
+
+            auto what() const noexcept -> std::string_view {
+                return "large";
+            }
+    };
+
+    enum class Errc { timeout, refused };
+
+    /// Counts how many times std::format formats it.
+    struct FormatCounter {
+            i32 value;
+
+            static thread_local i32 formats;
+    };
+
+    thread_local i32 FormatCounter::formats = 0;
+
+    auto messages(const Error& e) -> std::vector<std::string> {
+        auto out = std::vector<std::string>();
+        e.write([&](std::string_view what) { out.emplace_back(what); });
+        return out;
+    }
+
+}; // namespace
+
+template <> struct lx::trait::ErrorImpl<Errc> {
+        static auto what(Errc e) noexcept -> std::string_view {
+            return e == Errc::timeout ? "timed out" : "connection refused";
+        }
+};
+
+template <> struct std::formatter<FormatCounter> {
+        constexpr auto parse(std::format_parse_context& ctx) {
+            return ctx.begin();
+        }
+
+        auto format(const FormatCounter& counter,
+                    std::format_context& ctx) const {
+            FormatCounter::formats += 1;
+            return std::format_to(ctx.out(), "{}", counter.value);
+        }
+};
+
+TEST_CASE("Error from literal borrows it", "[lx::core::Error]") {
+    auto e = Error(not_found);
+    REQUIRE(e.what() == "File not found");
+    REQUIRE(e.what().data() == not_found);
+
+    auto moved = std::move(e);
+    REQUIRE(moved.what().data() == not_found);
+}
+
+TEST_CASE("Error from runtime string copies it", "[lx::core::Error]") {
+    auto msg = std::string("disk full");
+    auto e = Error(msg);
+    msg.clear();
+    REQUIRE(e.what() == "disk full");
+
+    char buffer[] = "buffer";
+    auto from_buffer = Error(buffer);
+    buffer[0] = 'B';
+    REQUIRE(from_buffer.what() == "buffer");
+}
+
+TEST_CASE("Local arrays are copied, not borrowed", "[lx::core::Error]") {
+    // Every message comes from a stack frame that is gone by the time it
+    // is read
+    auto fail = []() -> Result<i32, Error> {
+        char file[] = "config.toml";
+        char step[] = "while loading";
+        return Result<i32, Error>(Err(file)).context(step);
+    };
+
+    STATIC_REQUIRE(std::same_as<decltype(Err(std::declval<char (&)[4]>())),
+                                Err<std::string>>);
+
+    auto r = fail();
+    REQUIRE(messages(r.unwrap_err()) ==
+            std::vector<std::string>{"while loading", "config.toml"});
+
+    char outer[] = "outer";
+    auto e = Error("inner").context(outer);
+    outer[0] = 'O';
+    REQUIRE(e.what() == "outer");
+}
+
+TEST_CASE("Err literal reaches Error without copying", "[lx::core::Error]") {
+    auto f = []() -> Result<i32, Error> { return Err(not_found); };
+
+    auto r = f();
+    REQUIRE(r.is_err());
+    REQUIRE(r.unwrap_err().what().data() == not_found);
+}
+
+TEST_CASE("Error context chain", "[lx::core::Error]") {
+    auto load = []() -> Result<i32, Error> {
+        return Err("File not found");
+    };
+    auto runtime = std::string("Failed to load .env");
+
+    auto r = load().context(runtime).context("Startup failed");
+    auto chain = messages(r.unwrap_err());
+
+    REQUIRE(chain.size() == 3);
+    REQUIRE(chain[0] == "Startup failed");
+    REQUIRE(chain[1] == "Failed to load .env");
+    REQUIRE(chain[2] == "File not found");
+}
+
+TEST_CASE("Error move assignment", "[lx::core::Error]") {
+    auto a = Error("first");
+    auto b = Error(std::string("second")).context("outer");
+
+    a = std::move(b);
+    REQUIRE(messages(a) == std::vector<std::string>{"outer", "second"});
+
+    b = Error("third");
+    REQUIRE(b.what() == "third");
+}
+
+TEST_CASE("Error context beyond the first frames", "[lx::core::Error]") {
+    auto e = Error("root");
+    for (auto i = 0; i < 20; i++) e = e.context(std::to_string(i));
+
+    auto chain = messages(e);
+    REQUIRE(chain.size() == 21);
+    REQUIRE(chain.front() == "19");
+    REQUIRE(chain[19] == "0");
+    REQUIRE(chain.back() == "root");
+}
+
+TEST_CASE("Error context_fmt formats into the frame", "[lx::core::Error]") {
+    auto path = std::string(".env");
+
+    auto e = Error("File not found").context_fmt("line {} of {}", 12, path);
+    REQUIRE(e.what() == "line 12 of .env");
+
+    e = e.context_fmt("no arguments");
+    e = e.context_fmt("{}", "");
+    REQUIRE(messages(e) == std::vector<std::string>{
+                               "", "no arguments", "line 12 of .env",
+                               "File not found"});
+}
+
+TEST_CASE("Error context_fmt formats its arguments once",
+          "[lx::core::Error]") {
+    FormatCounter::formats = 0;
+
+    auto e = Error("refused").context_fmt("port {}", FormatCounter{8080});
+    REQUIRE(e.what() == "port 8080");
+    REQUIRE(FormatCounter::formats == 1);
+
+    // Longer than the stack buffer: formatted again into the frame
+    auto path = std::string(300, 'a');
+    e = e.context_fmt("reading {}", path);
+    REQUIRE(e.what() == "reading " + path);
+    REQUIRE(messages(e) == std::vector<std::string>{
+                               "reading " + path, "port 8080", "refused"});
+}
+
+TEST_CASE("Result lazy context only runs on errors", "[lx::core::Error]") {
+    auto calls = 0;
+    auto describe = [&] {
+        calls++;
+        return "attempt " + std::to_string(calls);
+    };
+
+    auto ok = Result<i32, Error>(Ok(7)).with_context(describe);
+    REQUIRE(ok.unwrap() == 7);
+    REQUIRE(calls == 0);
+
+    auto err = Result<i32, Error>(Err("refused")).with_context(describe);
+    REQUIRE(calls == 1);
+    REQUIRE(err.unwrap_err().what() == "attempt 1");
+
+    auto literal = Result<i32, Error>(Err("refused")).with_context(
+        [] { return StaticStr("while connecting"); });
+    REQUIRE(literal.unwrap_err().what() == "while connecting");
+
+    auto port = 8080;
+    auto formatted = Result<i32, Error>(Ok(1)).context_fmt("port {}", port);
+    REQUIRE(formatted.unwrap() == 1);
+
+    auto failed = Result<i32, Error>(Err("refused"));
+    REQUIRE(failed.context_fmt("port {}", port).is_err());
+    REQUIRE(messages(failed.unwrap_err()) ==
+            std::vector<std::string>{"port 8080", "refused"});
+}
+
+TEST_CASE("ErrorArena scopes nest", "[lx::core::ErrorArena]") {
+    auto outer = ErrorArena();
+    auto inner = ErrorArena();
+    REQUIRE(ErrorArena::current() == nullptr);
+    {
+        auto outer_scope = outer.enter();
+        REQUIRE(ErrorArena::current() == &outer);
+        {
+            auto inner_scope = inner.enter();
+            REQUIRE(ErrorArena::current() == &inner);
+        }
+        REQUIRE(ErrorArena::current() == &outer);
+    }
+    REQUIRE(ErrorArena::current() == nullptr);
+}
+
+TEST_CASE("ErrorArena holds context frames", "[lx::core::ErrorArena]") {
+    // Small chunks, so the frames spill over several of them
+    auto arena = ErrorArena(64);
+
+    for (auto round = 0; round < 3; round++) {
+        {
+            auto scope = arena.enter();
+
+            auto e = Error(std::string("root"));
+            for (auto i = 0; i < 10; i++)
+                e = e.context("layer " + std::to_string(i));
+            e = e.context("outermost");
+
+            e = e.context_fmt("round {}", round);
+
+            auto chain = messages(e);
+            REQUIRE(chain.size() == 13);
+            REQUIRE(chain.front() == "round " + std::to_string(round));
+            REQUIRE(chain[1] == "outermost");
+            REQUIRE(chain[2] == "layer 9");
+            REQUIRE(chain.back() == "root");
+        }
+
+        // Every Error is gone, so the arena can be reused
+        arena.reset();
+    }
+}
+
+TEST_CASE("Error outlives the scope of its arena", "[lx::core::ErrorArena]") {
+    auto arena = ErrorArena();
+    auto e = Error("root");
+    {
+        auto scope = arena.enter();
+        e = e.context(std::string("inside"));
+    }
+
+    // Frames stay in the arena the Error started with
+    e = e.context(std::string("outside"));
+    REQUIRE(messages(e) ==
+            std::vector<std::string>{"outside", "inside", "root"});
+}
+
+TEST_CASE("Error keeps small payloads inline", "[lx::core::Error]") {
+    STATIC_REQUIRE(impl::error_inline<ParseError>);
+
+    auto e = Error(ParseError{3, 14}).context("while reading config");
+    REQUIRE(e.what() == "while reading config");
+    REQUIRE(messages(e).back() == "unexpected token");
+
+    auto moved = std::move(e);
+    REQUIRE(moved.is<ParseError>());
+    REQUIRE(!moved.is<LargeError>());
+    REQUIRE(moved.downcast<ParseError>().unwrap().line == 3);
+    REQUIRE(moved.downcast<ParseError>().unwrap().column == 14);
+    REQUIRE(moved.downcast<LargeError>().is_none());
+}
+
+TEST_CASE("Error boxes large payloads", "[lx::core::Error]") {
+    STATIC_REQUIRE(!impl::error_inline<LargeError>);
+
+    auto drops = 0;
+    {
+        auto e = Error(LargeError(&drops));
+        auto moved = std::move(e);
+        REQUIRE(moved.what() == "large");
+
+        moved.downcast<LargeError>().unwrap().words[7] = 42;
+        REQUIRE(moved.downcast<LargeError>().unwrap().words[7] == 42);
+        REQUIRE(drops == 0);
+    }
+    REQUIRE(drops == 1);
+}
+
+TEST_CASE("Error payload through ErrorImpl", "[lx::core::Error]") {
+    auto f = []() -> Result<i32, Error> { return Err(Errc::refused); };
+
+    auto r = f();
+    REQUIRE(r.unwrap_err().what() == "connection refused");
+
+    auto e = std::move(r).unwrap_err();
+    REQUIRE(e.downcast<Errc>().unwrap() == Errc::refused);
+}
+
+TEST_CASE("String errors are not typed payloads", "[lx::core::Error]") {
+    auto e = Error(std::string("disk full"));
+    REQUIRE(e.downcast<std::string>().is_none());
+    REQUIRE(!Error("literal").is<StaticStr>());
+}
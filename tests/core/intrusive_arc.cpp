@@ -0,0 +1,183 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/intrusive_arc.hpp"
+#include "memory_helpers.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Node : AtomicRefCount {
+            Node(i32 v) noexcept : value(v) {
+            }
+
+            virtual ~Node() noexcept {
+                drops += 1;
+            }
+
+            auto self() const noexcept -> IntrusiveArc<const Node> {
+                return IntrusiveArc<const Node>::from_raw(this);
+            }
+
+            i32 value;
+
+            static thread_local i32 drops;
+    };
+
+    thread_local i32 Node::drops = 0;
+
+    struct Leaf : Node {
+            Leaf() noexcept : Node(7) {
+            }
+    };
+
+    struct LocalNode : LocalRefCount {
+            i32 value = 0;
+    };
+
+    /// Keeps its counter as a member and points the trait at it.
+    struct Token {
+            AtomicRefCount refs;
+            i32 id = 0;
+    };
+
+    /// Counts the objects it frees.
+    struct CountingNodeDeleter {
+            auto operator()(Node* node) const noexcept -> void {
+                deleted += 1;
+                delete node;
+            }
+
+            static thread_local i32 deleted;
+    };
+
+    thread_local i32 CountingNodeDeleter::deleted = 0;
+
+}; // namespace
+
+template <> struct lx::trait::IntrusiveImpl<Token> {
+        static auto counter(const Token& token) noexcept
+            -> const AtomicRefCount& {
+            return token.refs;
+        }
+};
+
+TEST_CASE("IntrusiveArc is one pointer", "[lx::core::IntrusiveArc]") {
+    STATIC_REQUIRE(sizeof(IntrusiveArc<Node>) == sizeof(void*));
+    STATIC_REQUIRE(sizeof(Option<IntrusiveArc<Node>>) == sizeof(void*));
+    STATIC_REQUIRE(lx::trait::Send<IntrusiveArc<Node>>);
+    STATIC_REQUIRE(!lx::trait::Send<IntrusiveArc<LocalNode>>);
+}
+
+TEST_CASE("IntrusiveArc counts inside the object",
+          "[lx::core::IntrusiveArc]") {
+    Node::drops = 0;
+    {
+        auto a = IntrusiveArc<Node>(1);
+        auto b = a;
+        REQUIRE(a->ref_count().count() == 2);
+        REQUIRE(b.strong_count().unwrap() == 2);
+        REQUIRE(IntrusiveArc<Node>::ptr_eq(a, b));
+
+        a.reset();
+        REQUIRE(b->value == 1);
+        REQUIRE(Node::drops == 0);
+    }
+    REQUIRE(Node::drops == 1);
+}
+
+TEST_CASE("IntrusiveArc from this", "[lx::core::IntrusiveArc]") {
+    Node::drops = 0;
+    auto self = IntrusiveArc<const Node>(0);
+    {
+        auto owner = IntrusiveArc<Node>(5);
+        self = owner->self();
+        REQUIRE(self.strong_count().unwrap() == 2);
+    }
+
+    // Only the node self pointed at first is gone
+    REQUIRE(Node::drops == 1);
+    REQUIRE(self->value == 5);
+    self.reset();
+    REQUIRE(Node::drops == 2);
+}
+
+TEST_CASE("IntrusiveArc derived to base", "[lx::core::IntrusiveArc]") {
+    Node::drops = 0;
+    {
+        auto leaf = IntrusiveArc<Leaf>();
+        auto base = IntrusiveArc<Node>(leaf);
+        REQUIRE(base->value == 7);
+        REQUIRE(leaf.strong_count().unwrap() == 2);
+
+        auto moved = IntrusiveArc<Node>(std::move(leaf));
+        REQUIRE(!static_cast<bool>(leaf));
+        REQUIRE(moved.strong_count().unwrap() == 2);
+    }
+    REQUIRE(Node::drops == 1);
+}
+
+TEST_CASE("IntrusiveArc custom deleter", "[lx::core::IntrusiveArc]") {
+    CountingNodeDeleter::deleted = 0;
+    {
+        auto a = IntrusiveArc<Node, CountingNodeDeleter>(3);
+        auto b = a;
+    }
+    REQUIRE(CountingNodeDeleter::deleted == 1);
+}
+
+TEST_CASE("IntrusiveArc derived to base keeps the deleter",
+          "[lx::core::IntrusiveArc]") {
+    using CountedLeaf = IntrusiveArc<Leaf, CountingNodeDeleter>;
+    using CountedNode = IntrusiveArc<Node, CountingNodeDeleter>;
+
+    STATIC_REQUIRE(std::constructible_from<CountedNode, CountedLeaf>);
+    STATIC_REQUIRE(!std::constructible_from<IntrusiveArc<Node>, CountedLeaf>);
+    STATIC_REQUIRE(!std::constructible_from<CountedNode, IntrusiveArc<Leaf>>);
+
+    CountingNodeDeleter::deleted = 0;
+    {
+        auto leaf = CountedLeaf();
+        auto base = CountedNode(leaf);
+        auto moved = CountedNode(std::move(leaf));
+        REQUIRE(moved->value == 7);
+        REQUIRE(base.strong_count().unwrap() == 2);
+    }
+    REQUIRE(CountingNodeDeleter::deleted == 1);
+}
+
+TEST_CASE("IntrusiveArc with a member counter", "[lx::core::IntrusiveArc]") {
+    auto token = IntrusiveArc<Token>();
+    auto copy = token;
+    REQUIRE(token->refs.count() == 2);
+
+    copy.reset();
+    token.get_mut().unwrap().id = 4;
+    REQUIRE(token->id == 4);
+}
+
+TEST_CASE("IntrusiveArc local counter", "[lx::core::IntrusiveArc]") {
+    auto a = IntrusiveArc<LocalNode>();
+    auto b = a;
+    REQUIRE(a.get_mut().is_none());
+    b.reset();
+    a.get_mut().unwrap().value = 2;
+    REQUIRE(a->value == 2);
+}
+
+TEST_CASE("IntrusiveArc shared across threads", "[lx::core::IntrusiveArc]") {
+    auto root = IntrusiveArc<Node>(0);
+    auto threads = std::vector<std::thread>();
+
+    for (auto t = 0; t < 4; t++) {
+        threads.emplace_back([root] {
+            for (auto i = 0; i < 10000; i++) {
+                auto copy = root;
+                REQUIRE(copy->value == 0);
+            }
+        });
+    }
+
+    for (auto& thread : threads) thread.join();
+    REQUIRE(root.strong_count().unwrap() == 1);
+}
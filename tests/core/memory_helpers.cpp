@@ -1,3 +1,5 @@
 #include "memory_helpers.hpp"
 
 thread_local bool FlagDeleter::deleted = false;
+thread_local i32 DropCounter::drops = 0;
+thread_local i32 live_allocations = 0;
@@ -2,6 +2,9 @@
 
 #include "lastix/core/number.hpp"
 
+#include <cstddef>
+#include <memory>
+
 using namespace lx::core;
 
 struct TestStruct {
@@ -19,6 +22,15 @@ struct Derived : Base {
         i32 b = 7;
 };
 
+struct DropCounter : Base {
+
+        ~DropCounter() override {
+            drops += 1;
+        }
+
+        static thread_local i32 drops;
+};
+
 struct FlagDeleter {
         auto operator()(i32* ptr) const noexcept -> void {
 
@@ -32,3 +44,44 @@ struct FlagDeleter {
 
         static thread_local bool deleted;
 };
+
+/// Deleter with state: counts its calls in the counter it points to.
+struct CountingDeleter {
+        auto operator()(i32* ptr) const noexcept -> void {
+            if (ptr != nullptr) *calls += 1;
+
+            delete ptr;
+        }
+
+        i32* calls = nullptr;
+};
+
+/// Allocations made by CountingAllocator on this thread and not yet freed.
+extern thread_local i32 live_allocations;
+
+/// Stateless allocator that counts the live allocations of this thread.
+template <class T> struct CountingAllocator {
+
+        using value_type = T;
+
+        CountingAllocator() noexcept = default;
+
+        template <class U>
+        CountingAllocator(const CountingAllocator<U>&) noexcept {
+        }
+
+        auto allocate(std::size_t n) -> T* {
+            live_allocations += 1;
+            return std::allocator<T>().allocate(n);
+        }
+
+        auto deallocate(T* ptr, std::size_t n) noexcept -> void {
+            live_allocations -= 1;
+            std::allocator<T>().deallocate(ptr, n);
+        }
+
+        template <class U>
+        auto operator==(const CountingAllocator<U>&) const noexcept -> bool {
+            return true;
+        }
+};
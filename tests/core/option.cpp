@@ -0,0 +1,192 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/arc.hpp"
+#include "lastix/core/box.hpp"
+#include "lastix/core/error.hpp"
+#include "lastix/core/option.hpp"
+#include "lastix/core/rc.hpp"
+#include "memory_helpers.hpp"
+
+#include <string>
+#include <type_traits>
+
+TEST_CASE("Option niche layout", "[lx::core::Option]") {
+    STATIC_REQUIRE(sizeof(Option<Box<TestStruct>>) == sizeof(void*));
+    STATIC_REQUIRE(sizeof(Option<Arc<TestStruct>>) == sizeof(Arc<TestStruct>));
+    STATIC_REQUIRE(sizeof(Option<Rc<TestStruct>>) == sizeof(Rc<TestStruct>));
+    STATIC_REQUIRE(sizeof(Option<i32&>) == sizeof(void*));
+    STATIC_REQUIRE(sizeof(Option<Box<Error>>) == sizeof(void*));
+}
+
+TEST_CASE("Option basic", "[lx::core::Option]") {
+    Option<i32> none = None;
+    REQUIRE(none.is_none());
+    REQUIRE(none == None);
+
+    Option<std::string> some = Some(std::string("lastix"));
+    REQUIRE(some.is_some());
+    REQUIRE(some.unwrap() == "lastix");
+
+    auto copy = some;
+    REQUIRE(copy == some);
+
+    auto moved = std::move(some).unwrap();
+    REQUIRE(moved == "lastix");
+}
+
+TEST_CASE("Option of Box", "[lx::core::Option]") {
+    Option<Box<TestStruct>> none = None;
+    REQUIRE(none.is_none());
+
+    Option<Box<TestStruct>> some = Some(Box<TestStruct>(3));
+    REQUIRE(some.is_some());
+    REQUIRE(some.unwrap()->x == 3);
+
+    // Moving the Box out leaves an empty Box behind, which is still Some
+    auto box = std::move(some).unwrap();
+    REQUIRE(box->x == 3);
+    REQUIRE(some.is_some());
+    REQUIRE(!static_cast<bool>(some.unwrap()));
+
+    none = std::move(some);
+    REQUIRE(none.is_some());
+
+    some = None;
+    REQUIRE(some.is_none());
+}
+
+TEST_CASE("Option of Box drops the value", "[lx::core::Option]") {
+    DropCounter::drops = 0;
+    {
+        Option<Box<DropCounter>> some = Some(Box<DropCounter>());
+        some = None;
+        REQUIRE(DropCounter::drops == 1);
+
+        some = Some(Box<DropCounter>());
+        some.swap(some);
+    }
+    REQUIRE(DropCounter::drops == 2);
+}
+
+TEST_CASE("Option of Arc", "[lx::core::Option]") {
+    auto arc = Arc<TestStruct>(5);
+    {
+        Option<Arc<TestStruct>> a = Some(arc);
+        auto b = a;
+        REQUIRE(arc.strong_count().unwrap() == 3);
+        REQUIRE(b.unwrap()->x == 5);
+
+        Option<Arc<TestStruct>> none = None;
+        b = none;
+        REQUIRE(b.is_none());
+        REQUIRE(arc.strong_count().unwrap() == 2);
+    }
+    REQUIRE(arc.strong_count().unwrap() == 1);
+}
+
+TEST_CASE("Option of reference", "[lx::core::Option]") {
+    auto value = 1;
+    Option<i32&> ref = Some<i32&>(value);
+    REQUIRE(ref.is_some());
+
+    ref.unwrap() = 2;
+    REQUIRE(value == 2);
+
+    Option<i32&> none = None;
+    REQUIRE(none.is_none());
+    REQUIRE(none != ref);
+}
+
+TEST_CASE("Option map and and_then", "[lx::core::Option]") {
+    Option<i32> some = Some(2);
+    Option<i32> none = None;
+
+    REQUIRE(some.map([](i32 x) { return x * 3; }).unwrap() == 6);
+    REQUIRE(none.map([](i32 x) { return x * 3; }).is_none());
+
+    auto half = [](i32 x) -> Option<i32> {
+        if (x % 2 != 0) return None;
+        return Some(x / 2);
+    };
+    REQUIRE(some.and_then(half).unwrap() == 1);
+    REQUIRE(some.and_then(half).and_then(half).is_none());
+    REQUIRE(none.and_then(half).is_none());
+}
+
+TEST_CASE("Option map forwards instead of copying", "[lx::core::Option]") {
+    Option<Box<TestStruct>> some = Some(Box<TestStruct>(4));
+
+    // An lvalue Option lends the Box, an rvalue one gives it away
+    REQUIRE(some.map([](Box<TestStruct>& b) { return b->x; }).unwrap() == 4);
+    REQUIRE(some.unwrap()->x == 4);
+
+    auto box = std::move(some)
+                   .map([](Box<TestStruct>&& b) { return std::move(b); })
+                   .unwrap();
+    REQUIRE(box->x == 4);
+}
+
+TEST_CASE("Option fallbacks", "[lx::core::Option]") {
+    Option<i32> some = Some(2);
+    Option<i32> none = None;
+
+    REQUIRE(some.unwrap_or(7) == 2);
+    REQUIRE(none.unwrap_or(7) == 7);
+    REQUIRE(none.unwrap_or_else([] { return 8; }) == 8);
+
+    REQUIRE(some.or_else([] { return Option<i32>(Some(9)); }).unwrap() == 2);
+    REQUIRE(none.or_else([] { return Option<i32>(Some(9)); }).unwrap() == 9);
+}
+
+TEST_CASE("Option inspect", "[lx::core::Option]") {
+    auto seen = 0;
+    auto value = Option<i32>(Some(5))
+                     .inspect([&](const i32& x) { seen = x; })
+                     .unwrap();
+    REQUIRE(seen == 5);
+    REQUIRE(value == 5);
+
+    Option<i32> none = None;
+    none.inspect([&](const i32&) { seen = 0; });
+    REQUIRE(seen == 5);
+}
+
+TEST_CASE("Option views", "[lx::core::Option]") {
+    Option<std::string> some = Some(std::string("lastix"));
+
+    auto view = some.as_ref();
+    STATIC_REQUIRE(std::is_same_v<decltype(view), Option<const std::string&>>);
+    REQUIRE(&view.unwrap() == &some.unwrap());
+
+    some.as_mut().unwrap() += "!";
+    REQUIRE(some.unwrap() == "lastix!");
+
+    Option<std::string> none = None;
+    REQUIRE(none.as_ref().is_none());
+}
+
+TEST_CASE("Option take and replace", "[lx::core::Option]") {
+    Option<Box<TestStruct>> slot = Some(Box<TestStruct>(1));
+
+    auto taken = slot.take();
+    REQUIRE(slot.is_none());
+    REQUIRE(taken.unwrap()->x == 1);
+
+    auto previous = slot.replace(Box<TestStruct>(2));
+    REQUIRE(previous.is_none());
+    REQUIRE(slot.unwrap()->x == 2);
+
+    previous = slot.replace(Box<TestStruct>(3));
+    REQUIRE(previous.unwrap()->x == 2);
+    REQUIRE(slot.unwrap()->x == 3);
+}
+
+TEST_CASE("Option flatten", "[lx::core::Option]") {
+    Option<Option<i32>> nested = Some(Option<i32>(Some(1)));
+    REQUIRE(nested.flatten().unwrap() == 1);
+
+    Option<Option<i32>> inner_none = Some(Option<i32>(None));
+    REQUIRE(inner_none.flatten().is_none());
+
+    Option<Option<i32>> outer_none = None;
+    REQUIRE(outer_none.flatten().is_none());
+}
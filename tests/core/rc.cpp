@@ -0,0 +1,112 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/rc.hpp"
+#include "lastix/core/arc.hpp"
+#include "lastix/core/thread.hpp"
+#include "lastix/trait/sync.hpp"
+#include "memory_helpers.hpp"
+
+template <class... Args>
+concept Spawnable = requires(Args... args) { spawn(std::move(args)...); };
+
+TEST_CASE("Rc basic construction", "[lx::core::Rc]") {
+    auto ptr = Rc<TestStruct>(42);
+    REQUIRE(static_cast<bool>(ptr));
+    REQUIRE(ptr->x == 42);
+    REQUIRE((*ptr).x == 42);
+    REQUIRE(ptr.strong_count().unwrap() == 1);
+    REQUIRE(ptr.weak_count().unwrap() == 0);
+}
+
+TEST_CASE("Rc unsafe_from_raw", "[lx::core::Rc]") {
+    auto raw = new TestStruct(5);
+    auto ptr = Rc<TestStruct>::unsafe_from_raw(raw);
+    REQUIRE(ptr->x == 5);
+    REQUIRE(ptr.unsafe_get() == raw);
+}
+
+TEST_CASE("Rc copy and swap", "[lx::core::Rc]") {
+    auto a = Rc<TestStruct>(5);
+    auto b = Rc<TestStruct>(10);
+    {
+        auto c = a;
+        REQUIRE(a.strong_count().unwrap() == 2);
+    }
+    REQUIRE(a.strong_count().unwrap() == 1);
+
+    a.swap(b);
+    REQUIRE(a->x == 10);
+    REQUIRE(b->x == 5);
+}
+
+TEST_CASE("Rc custom deleter and reset", "[lx::core::Rc]") {
+
+    FlagDeleter::deleted = false;
+    {
+        auto ptr = Rc<i32, FlagDeleter>(52);
+        REQUIRE(*ptr == 52);
+        ptr.reset();
+        REQUIRE(FlagDeleter::deleted);
+        REQUIRE(ptr.strong_count() == None);
+
+        // Try to reset null Rc
+        ptr.reset();
+    }
+}
+
+TEST_CASE("Rc gives mutable access to non-Sync values", "[lx::core::Rc]") {
+    STATIC_REQUIRE(!lx::trait::Sync<TestStruct>);
+
+    auto a = Rc<TestStruct>(1);
+    auto b = a;
+
+    a->x = 2;
+    REQUIRE(b->x == 2);
+
+    (*b).x = 3;
+    REQUIRE(a->x == 3);
+}
+
+TEST_CASE("Rc destroys derived value through base", "[lx::core::Rc]") {
+
+    DropCounter::drops = 0;
+    {
+        auto a = Rc<Base>(Rc<DropCounter>());
+        auto b = a;
+        REQUIRE(b->a == 0);
+    }
+    REQUIRE(DropCounter::drops == 1);
+}
+
+TEST_CASE("RcWeak upgrade", "[lx::core::RcWeak]") {
+
+    DropCounter::drops = 0;
+
+    auto a = Rc<DropCounter>();
+    auto w = a.downgrade();
+    REQUIRE(a.weak_count().unwrap() == 1);
+    REQUIRE(w.upgrade().is_some());
+
+    a.reset();
+    REQUIRE(DropCounter::drops == 1);
+    REQUIRE(w.upgrade() == None);
+    REQUIRE(w.strong_count().unwrap() == 0);
+    REQUIRE(w.weak_count().unwrap() == 1);
+}
+
+TEST_CASE("Rc is not Send", "[lx::core::Rc]") {
+    STATIC_REQUIRE(!lx::trait::Send<Rc<i32>>);
+    STATIC_REQUIRE(!lx::trait::Send<RcWeak<i32>>);
+    STATIC_REQUIRE(!lx::trait::Send<Arc<Rc<i32>>>);
+    STATIC_REQUIRE(!lx::trait::Send<Option<Rc<i32>>>);
+    STATIC_REQUIRE(lx::trait::Send<Arc<i32>>);
+
+    auto sum = [](Arc<i32> value) {
+        return *value + 1;
+    };
+
+    // This should not compile:
+    // spawn(sum, Rc<i32>(1));
+
+    STATIC_REQUIRE(Spawnable<decltype(sum), Arc<i32>>);
+    STATIC_REQUIRE(!Spawnable<decltype(sum), Rc<i32>>);
+}
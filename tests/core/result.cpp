@@ -1,8 +1,12 @@
 #include "catch2/catch_test_macros.hpp"
+#include "lastix/core/box.hpp"
+#include "lastix/core/error.hpp"
 #include "lastix/core/result.hpp"
 #include "lastix/core/number.hpp"
+#include "memory_helpers.hpp"
 
 #include <string>
+#include <type_traits>
 
 using namespace lx::core;
 
@@ -83,3 +87,163 @@ TEST_CASE("Result construction with From trait", "[lx::core::Result]") {
     REQUIRE(r0.is_err());
     REQUIRE(r0.unwrap_err() == ErrorB::FileError);
 }
+
+TEST_CASE("Result layout", "[lx::core::Result]") {
+    STATIC_REQUIRE(std::is_trivially_copyable_v<Result<i32, ErrorA>>);
+    STATIC_REQUIRE(sizeof(Result<i32, ErrorA>) == 2 * sizeof(i32));
+    STATIC_REQUIRE(sizeof(Result<void, ErrorA>) == 2 * sizeof(i32));
+
+    // vtable pointer, inline payload buffer, context pointer: six words on
+    // 64-bit targets. The tag lives in Error's niche, the Ok arm next to it
+    STATIC_REQUIRE(sizeof(Error) ==
+                   2 * sizeof(void*) + impl::error_inline_size);
+    STATIC_REQUIRE(sizeof(void*) != 8 || sizeof(Error) == 48);
+    STATIC_REQUIRE(sizeof(Result<Box<i32>, Error>) == sizeof(Error));
+    STATIC_REQUIRE(sizeof(Result<i32, Error>) == sizeof(Error));
+    STATIC_REQUIRE(sizeof(Result<void, Error>) == sizeof(Error));
+}
+
+TEST_CASE("Result with Error niche", "[lx::core::Result]") {
+    Result<Box<i32>, Error> ok = Ok(Box<i32>(5));
+    REQUIRE(ok.is_ok());
+    REQUIRE(*ok.unwrap() == 5);
+
+    Result<Box<i32>, Error> err = Err(Error("failure").context("reading"));
+    REQUIRE(err.is_err());
+    REQUIRE(err.unwrap_err().what() == "reading");
+
+    err = std::move(ok);
+    REQUIRE(err.is_ok());
+    REQUIRE(*err.unwrap() == 5);
+
+    auto moved = std::move(err).unwrap();
+    REQUIRE(*moved == 5);
+}
+
+TEST_CASE("Result drops the active arm", "[lx::core::Result]") {
+    DropCounter::drops = 0;
+    {
+        Result<Box<DropCounter>, Error> r = Ok(Box<DropCounter>());
+        r = Err(Error("failure"));
+        REQUIRE(DropCounter::drops == 1);
+        REQUIRE(r.is_err());
+    }
+    REQUIRE(DropCounter::drops == 1);
+}
+
+TEST_CASE("Result same arm types", "[lx::core::Result]") {
+    Result<i32, i32> ok = Ok(1);
+    Result<i32, i32> err = Err(1);
+    REQUIRE(ok.is_ok());
+    REQUIRE(err.is_err());
+    REQUIRE(ok != err);
+}
+
+TEST_CASE("Result match", "[lx::core::Result]") {
+    Result<i32, std::string> ok = Ok(2);
+    Result<i32, std::string> err = Err("failure");
+
+    auto describe = [](const Result<i32, std::string>& r) {
+        return r.match([](i32 v) { return std::to_string(v); },
+                       [](const std::string& e) { return "error: " + e; });
+    };
+
+    REQUIRE(describe(ok) == "2");
+    REQUIRE(describe(err) == "error: failure");
+
+    auto taken = std::move(err).match([](i32) { return std::string(); },
+                                      [](std::string e) { return e; });
+    REQUIRE(taken == "failure");
+}
+
+TEST_CASE("Result map and map_err", "[lx::core::Result]") {
+    Result<i32, std::string> ok = Ok(2);
+    Result<i32, std::string> err = Err("failure");
+
+    REQUIRE(ok.map([](i32 x) { return x * 2; }).unwrap() == 4);
+    REQUIRE(err.map([](i32 x) { return x * 2; }).unwrap_err() == "failure");
+
+    auto size = [](const std::string& e) { return e.size(); };
+    REQUIRE(ok.map_err(size).unwrap() == 2);
+    REQUIRE(err.map_err(size).unwrap_err() == 7);
+
+    Result<void, i32> done = Ok();
+    auto called = false;
+    REQUIRE(done.map([&] { called = true; }).is_ok());
+    REQUIRE(called);
+}
+
+TEST_CASE("Result map moves out of rvalues", "[lx::core::Result]") {
+    Result<Box<TestStruct>, i32> ok = Ok(Box<TestStruct>(3));
+
+    REQUIRE(ok.map([](const Box<TestStruct>& b) { return b->x; }).unwrap() ==
+            3);
+
+    auto box = std::move(ok)
+                   .map([](Box<TestStruct>&& b) { return std::move(b); })
+                   .unwrap();
+    REQUIRE(box->x == 3);
+}
+
+TEST_CASE("Result and_then and or_else", "[lx::core::Result]") {
+    auto parse = [](i32 x) -> Result<i32, std::string> {
+        if (x < 0) return Err("negative");
+        return Ok(x + 1);
+    };
+
+    Result<i32, std::string> ok = Ok(1);
+    REQUIRE(ok.and_then(parse).and_then(parse).unwrap() == 3);
+
+    Result<i32, std::string> negative = Ok(-1);
+    REQUIRE(negative.and_then(parse).unwrap_err() == "negative");
+
+    auto recover = [](const std::string&) -> Result<i32, ErrorB> {
+        return Ok(0);
+    };
+    REQUIRE(negative.and_then(parse).or_else(recover).unwrap() == 0);
+    REQUIRE(ok.or_else(recover).unwrap() == 1);
+}
+
+TEST_CASE("Result fallbacks", "[lx::core::Result]") {
+    Result<i32, ErrorA> ok = Ok(1);
+    Result<i32, ErrorA> err = Err(ErrorA::NotFound);
+
+    REQUIRE(ok.unwrap_or(5) == 1);
+    REQUIRE(err.unwrap_or(5) == 5);
+    REQUIRE(err.unwrap_or_else([](ErrorA e) {
+        return e == ErrorA::NotFound ? 6 : 7;
+    }) == 6);
+}
+
+TEST_CASE("Result inspect", "[lx::core::Result]") {
+    auto seen = 0;
+    auto failed = false;
+
+    Result<i32, ErrorA> ok = Ok(4);
+    ok.inspect([&](const i32& x) { seen = x; })
+        .inspect_err([&](const ErrorA&) { failed = true; });
+
+    REQUIRE(seen == 4);
+    REQUIRE(!failed);
+}
+
+TEST_CASE("Result flatten and transpose", "[lx::core::Result]") {
+    Result<Result<i32, ErrorA>, ErrorA> nested = Ok(Result<i32, ErrorA>(Ok(1)));
+    REQUIRE(nested.flatten().unwrap() == 1);
+
+    Result<Result<i32, ErrorA>, ErrorA> outer = Err(ErrorA::IoError);
+    REQUIRE(outer.flatten().unwrap_err() == ErrorA::IoError);
+
+    Result<Option<i32>, ErrorA> some = Ok(Option<i32>(Some(2)));
+    REQUIRE(some.transpose().unwrap().unwrap() == 2);
+
+    Result<Option<i32>, ErrorA> none = Ok(Option<i32>(None));
+    REQUIRE(none.transpose().is_none());
+
+    Option<Result<i32, ErrorA>> back = some.transpose();
+    REQUIRE(back.transpose().unwrap().unwrap() == 2);
+
+    Option<Result<i32, ErrorA>> failed = Some(Result<i32, ErrorA>(
+        Err(ErrorA::PermissionDenied)));
+    REQUIRE(failed.transpose().unwrap_err() == ErrorA::PermissionDenied);
+}
@@ -0,0 +1,126 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/box.hpp"
+#include "lastix/core/error.hpp"
+#include "lastix/core/try.hpp"
+#include "memory_helpers.hpp"
+
+#include <string>
+
+enum class LexError { UnexpectedEnd };
+
+enum class ParseError { Lex, Syntax };
+
+template <> struct lx::trait::FromImpl<LexError, ParseError> {
+        static auto from(LexError) -> ParseError {
+            return ParseError::Lex;
+        }
+};
+
+namespace {
+
+    auto lex(i32 x) -> Result<i32, LexError> {
+        if (x < 0) return Err(LexError::UnexpectedEnd);
+        return Ok(x);
+    }
+
+    auto parse(i32 x) -> Result<i32, ParseError> {
+        auto token = LX_TRY(lex(x));
+        if (token == 0) return Err(ParseError::Syntax);
+        return Ok(token * 10);
+    }
+
+    auto make_box(bool ok) -> Result<Box<TestStruct>, Error> {
+        if (!ok) return Err("no box");
+        return Ok(Box<TestStruct>(5));
+    }
+
+    auto unbox(bool ok) -> Result<i32, Error> {
+        auto box = LX_TRY(make_box(ok));
+        return Ok(box->x);
+    }
+
+    auto context_calls = 0;
+
+    auto describe() -> std::string {
+        context_calls++;
+        return "while unboxing";
+    }
+
+    auto unbox_with_context(bool ok) -> Result<i32, Error> {
+        auto box = LX_TRY_CONTEXT(make_box(ok), describe());
+        return Ok(box->x);
+    }
+
+    auto first_even(Option<i32> x) -> Option<i32> {
+        auto value = LX_TRY(std::move(x));
+        if (value % 2 != 0) return None;
+        return Some(value);
+    }
+
+    auto make_token(bool ok) -> Result<i32, Box<TestStruct>> {
+        if (!ok) return Err(Box<TestStruct>(9));
+        return Ok(1);
+    }
+
+    /// A named Result is moved in, so a move-only error still propagates.
+    auto checked_token(bool ok) -> Result<i32, Box<TestStruct>> {
+        auto result = make_token(ok);
+        auto token = LX_TRY(std::move(result));
+        return Ok(token + 1);
+    }
+
+    namespace shadow {
+
+        /// The macros must not pick up this namespace for std::forward.
+        namespace std {};
+
+        auto unbox(bool ok) -> Result<i32, Error> {
+            auto box = LX_TRY(make_box(ok));
+            auto again = LX_TRY_CONTEXT(make_box(ok), "again");
+            return Ok(box->x + again->x);
+        }
+
+    }; // namespace shadow
+
+}; // namespace
+
+TEST_CASE("LX_TRY yields the Ok value", "[lx::core::LX_TRY]") {
+    REQUIRE(parse(3).unwrap() == 30);
+    REQUIRE(unbox(true).unwrap() == 5);
+}
+
+TEST_CASE("LX_TRY returns the error early", "[lx::core::LX_TRY]") {
+    REQUIRE(parse(0).unwrap_err() == ParseError::Syntax);
+
+    // Converted through lx::trait::From
+    REQUIRE(parse(-1).unwrap_err() == ParseError::Lex);
+
+    REQUIRE(unbox(false).unwrap_err().what() == "no box");
+}
+
+TEST_CASE("LX_TRY_CONTEXT formats only on error", "[lx::core::LX_TRY]") {
+    context_calls = 0;
+
+    REQUIRE(unbox_with_context(true).unwrap() == 5);
+    REQUIRE(context_calls == 0);
+
+    auto error = unbox_with_context(false).unwrap_err();
+    REQUIRE(context_calls == 1);
+    REQUIRE(error.what() == "while unboxing");
+}
+
+TEST_CASE("LX_TRY moves a move-only error out", "[lx::core::LX_TRY]") {
+    REQUIRE(checked_token(true).unwrap() == 2);
+    REQUIRE(checked_token(false).unwrap_err()->x == 9);
+}
+
+TEST_CASE("LX_TRY qualifies std", "[lx::core::LX_TRY]") {
+    REQUIRE(shadow::unbox(true).unwrap() == 10);
+    REQUIRE(shadow::unbox(false).unwrap_err().what() == "no box");
+}
+
+TEST_CASE("LX_TRY on Option returns None", "[lx::core::LX_TRY]") {
+    REQUIRE(first_even(Some(4)).unwrap() == 4);
+    REQUIRE(first_even(Some(3)).is_none());
+    REQUIRE(first_even(None).is_none());
+}
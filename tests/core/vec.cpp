@@ -0,0 +1,243 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/arc.hpp"
+#include "lastix/core/box.hpp"
+#include "lastix/core/number.hpp"
+#include "lastix/core/vec.hpp"
+#include "memory_helpers.hpp"
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+    template <class T, class Alloc>
+    auto values(const Vec<T, Alloc>& vec) -> std::vector<T> {
+        return std::vector<T>(vec.begin(), vec.end());
+    }
+
+    auto strings(std::initializer_list<const char*> items)
+        -> Vec<std::string> {
+
+        auto vec = Vec<std::string>();
+        for (const auto* item : items) vec.push(item);
+
+        return vec;
+    }
+
+    /// Counts its moves and destructions; Relocatable opts into memcpy.
+    template <bool Relocatable> struct Tracked {
+            Tracked() noexcept = default;
+
+            Tracked(Tracked&&) noexcept {
+                moves += 1;
+            }
+
+            ~Tracked() noexcept {
+                destroys += 1;
+            }
+
+            static auto reset() noexcept -> void {
+                moves = 0;
+                destroys = 0;
+            }
+
+            static inline thread_local i32 moves = 0;
+            static inline thread_local i32 destroys = 0;
+    };
+
+}; // namespace
+
+template <>
+struct lx::trait::UnsafeTriviallyRelocatableMarker<Tracked<true>> {
+        static constexpr auto value = true;
+};
+
+TEST_CASE("Vec push, pop and index", "[lx::core::Vec]") {
+    auto vec = Vec<i32>();
+    REQUIRE(vec.is_empty());
+    REQUIRE(vec.capacity() == 0);
+
+    for (auto i = 0; i < 100; i++) vec.push(i);
+    REQUIRE(vec.len() == 100);
+    REQUIRE(vec.capacity() >= 100);
+    REQUIRE(vec[0] == 0);
+    REQUIRE(vec[99] == 99);
+
+    vec[5] = 50;
+    REQUIRE(vec.as_span()[5] == 50);
+
+    REQUIRE(vec.pop().unwrap() == 99);
+    REQUIRE(vec.len() == 99);
+
+    auto sum = 0;
+    for (auto value : vec) sum += value;
+    REQUIRE(sum == 99 * 98 / 2 + 45);
+
+    vec.clear();
+    REQUIRE(vec.pop().is_none());
+}
+
+TEST_CASE("Vec fallible growth", "[lx::core::Vec]") {
+    auto vec = Vec<u64>::with_capacity(4);
+    REQUIRE(vec.capacity() >= 4);
+
+    REQUIRE(vec.try_push(1).is_ok());
+    REQUIRE(vec.try_reserve(1000).is_ok());
+    REQUIRE(vec.capacity() >= 1001);
+
+    auto capacity = vec.capacity();
+    auto overflow = vec.try_reserve(std::numeric_limits<usize>::max());
+    REQUIRE(overflow.is_err());
+    REQUIRE(overflow.unwrap_err().what() == "Vec capacity overflow");
+
+    // A failed reservation leaves the Vec alone
+    REQUIRE(vec.capacity() == capacity);
+    REQUIRE(values(vec) == std::vector<u64>{1});
+}
+
+TEST_CASE("Vec moves elements that are not relocatable",
+          "[lx::core::Vec]") {
+    STATIC_REQUIRE(!lx::trait::TriviallyRelocatable<std::string>);
+
+    auto vec = Vec<std::string>();
+    for (auto i = 0; i < 50; i++)
+        vec.push("a string too long for the small buffer " +
+                 std::to_string(i));
+
+    REQUIRE(vec.len() == 50);
+    REQUIRE(vec[0] == "a string too long for the small buffer 0");
+    REQUIRE(vec[49] == "a string too long for the small buffer 49");
+
+    vec.shrink_to_fit();
+    REQUIRE(vec.capacity() == 50);
+    REQUIRE(vec[49] == "a string too long for the small buffer 49");
+}
+
+TEST_CASE("Vec relocates smart pointers by copying bytes",
+          "[lx::core::Vec]") {
+    STATIC_REQUIRE(lx::trait::TriviallyRelocatable<Box<i32>>);
+    STATIC_REQUIRE(lx::trait::TriviallyRelocatable<Arc<i32>>);
+    STATIC_REQUIRE(lx::trait::TriviallyRelocatable<Option<Box<i32>>>);
+    STATIC_REQUIRE(lx::trait::TriviallyRelocatable<Vec<Box<i32>>>);
+    STATIC_REQUIRE(sizeof(Option<Vec<i32>>) == sizeof(Vec<i32>));
+
+    auto shared = Arc<i32>(7);
+    {
+        auto vec = Vec<Arc<i32>>();
+        for (auto i = 0; i < 1000; i++) vec.push(shared);
+
+        REQUIRE(shared.strong_count().unwrap() == 1001);
+        REQUIRE(*vec[999] == 7);
+    }
+    REQUIRE(shared.strong_count().unwrap() == 1);
+
+    DropCounter::drops = 0;
+    {
+        auto vec = Vec<Box<DropCounter>>();
+        for (auto i = 0; i < 100; i++) vec.push(Box<DropCounter>());
+        REQUIRE(DropCounter::drops == 0);
+    }
+    REQUIRE(DropCounter::drops == 100);
+}
+
+TEST_CASE("Vec growth copies bytes only for relocatable types",
+          "[lx::core::Vec]") {
+    auto grow = []<bool Relocatable>(std::bool_constant<Relocatable>) {
+        auto vec = Vec<Tracked<Relocatable>>();
+        for (auto i = 0; i < 10; i++) vec.push(Tracked<Relocatable>());
+
+        Tracked<Relocatable>::reset();
+        vec.reserve(vec.capacity() - vec.len() + 1);
+    };
+
+    grow(std::true_type());
+    REQUIRE(Tracked<true>::moves == 0);
+    REQUIRE(Tracked<true>::destroys == 10);
+
+    // Moved one by one: one move and one destructor call each
+    grow(std::false_type());
+    REQUIRE(Tracked<false>::moves == 10);
+    REQUIRE(Tracked<false>::destroys == 20);
+}
+
+TEST_CASE("Vec extend_from_slice", "[lx::core::Vec]") {
+    auto numbers = std::vector<i32>{1, 2, 3};
+    auto vec = Vec<i32>();
+    vec.extend_from_slice(numbers);
+    REQUIRE(values(vec) == numbers);
+
+    // From itself, while growing moves the elements
+    vec.extend_from_slice(vec.as_span());
+    REQUIRE(values(vec) == std::vector<i32>{1, 2, 3, 1, 2, 3});
+
+    auto words = strings({"one", "two"});
+    words.extend_from_slice(words.as_span());
+    REQUIRE(values(words) ==
+            std::vector<std::string>{"one", "two", "one", "two"});
+}
+
+TEST_CASE("Vec drain", "[lx::core::Vec]") {
+    auto vec = strings({"a", "b", "c", "d", "e", "f"});
+    {
+        auto drain = vec.drain(1, 4);
+        REQUIRE(drain.len() == 3);
+        REQUIRE(drain.next().unwrap() == "b");
+        REQUIRE(vec.len() == 1);
+    }
+    REQUIRE(values(vec) == std::vector<std::string>{"a", "e", "f"});
+
+    {
+        auto drain = vec.drain(0, vec.len());
+        auto taken = std::vector<std::string>();
+        while (auto next = drain.next()) taken.push_back(next.unwrap());
+        REQUIRE(taken == std::vector<std::string>{"a", "e", "f"});
+    }
+    REQUIRE(vec.is_empty());
+
+    DropCounter::drops = 0;
+    auto boxes = Vec<Box<DropCounter>>();
+    for (auto i = 0; i < 10; i++) boxes.push(Box<DropCounter>());
+    {
+        auto drain = boxes.drain(2, 8);
+        auto first = drain.next();
+        REQUIRE(DropCounter::drops == 0);
+    }
+    REQUIRE(DropCounter::drops == 6);
+    REQUIRE(boxes.len() == 4);
+}
+
+TEST_CASE("Vec retain", "[lx::core::Vec]") {
+    auto vec = Vec<i32>();
+    for (auto i = 0; i < 10; i++) vec.push(i);
+
+    vec.retain([](i32 v) { return v % 3 != 0; });
+    REQUIRE(values(vec) == std::vector<i32>{1, 2, 4, 5, 7, 8});
+
+    auto words = strings({"keep", "drop", "keep too", "drop", "last"});
+    words.retain([](const std::string& s) { return s != "drop"; });
+    REQUIRE(values(words) ==
+            std::vector<std::string>{"keep", "keep too", "last"});
+
+    words.retain([](const std::string&) { return false; });
+    REQUIRE(words.is_empty());
+}
+
+TEST_CASE("Vec into_boxed_slice", "[lx::core::Vec]") {
+    live_allocations = 0;
+    {
+        auto vec = Vec<std::string, CountingAllocator<std::string>>();
+        for (auto i = 0; i < 20; i++) vec.push(std::to_string(i));
+        REQUIRE(live_allocations == 1);
+
+        auto* data = vec.unsafe_get();
+        auto slice = std::move(vec).into_boxed_slice();
+        REQUIRE(vec.is_empty());
+        REQUIRE(slice.len() == 20);
+        REQUIRE(slice.unsafe_get() == data);
+        REQUIRE(slice[19] == "19");
+        REQUIRE(live_allocations == 1);
+    }
+    REQUIRE(live_allocations == 0);
+}
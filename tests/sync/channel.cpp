@@ -0,0 +1,227 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/box.hpp"
+#include "lastix/sync/channel.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace lx::core;
+using namespace lx::sync;
+
+namespace {
+
+    struct Counted {
+            static inline std::atomic<i32> live = 0;
+
+            u64 value;
+
+            explicit Counted(u64 v) : value(v) {
+                live.fetch_add(1);
+            }
+
+            Counted(Counted&& other) noexcept : value(other.value) {
+                live.fetch_add(1);
+            }
+
+            ~Counted() {
+                live.fetch_sub(1);
+            }
+    };
+
+}; // namespace
+
+TEST_CASE("channel try_send and try_recv", "[lx::sync::channel]") {
+    auto [tx, rx] = channel<i32>(4);
+    REQUIRE(tx.capacity() == 4);
+    REQUIRE(rx.try_recv().is_none());
+
+    for (auto i = 0; i < 4; i++) REQUIRE(tx.try_send(i).is_ok());
+
+    auto full = tx.try_send(4);
+    REQUIRE(full.is_err());
+    REQUIRE(full.unwrap_err().is_full());
+
+    for (auto i = 0; i < 4; i++) REQUIRE(rx.try_recv().unwrap() == i);
+    REQUIRE(rx.try_recv().is_none());
+}
+
+TEST_CASE("channel rounds the capacity up", "[lx::sync::channel]") {
+    auto [tx, rx] = channel<i32>(1);
+    REQUIRE(tx.capacity() == 2);
+
+    auto [stx, srx] = spsc_channel<i32>(5);
+    REQUIRE(srx.capacity() == 8);
+}
+
+TEST_CASE("channel hands back values it cannot send",
+          "[lx::sync::channel]") {
+    auto [tx, rx] = channel<Box<i32>>(2);
+    {
+        auto dropped = std::move(rx);
+    }
+
+    REQUIRE(tx.is_disconnected());
+
+    auto failed = tx.try_send(Box<i32>(7));
+    REQUIRE(failed.is_err());
+
+    auto error = std::move(failed).unwrap_err();
+    REQUIRE(error.is_disconnected());
+    REQUIRE(*std::move(error).into_inner() == 7);
+
+    auto blocked = tx.send(Box<i32>(8));
+    REQUIRE(*std::move(blocked).unwrap_err().into_inner() == 8);
+}
+
+TEST_CASE("channel recv drains before reporting disconnect",
+          "[lx::sync::channel]") {
+    auto [tx, rx] = channel<i32>(4);
+    REQUIRE(tx.send(1).is_ok());
+    REQUIRE(tx.send(2).is_ok());
+    {
+        auto dropped = std::move(tx);
+    }
+
+    REQUIRE(rx.is_disconnected());
+    REQUIRE(rx.recv().unwrap() == 1);
+    REQUIRE(rx.recv().unwrap() == 2);
+    REQUIRE(rx.recv().is_none());
+}
+
+TEST_CASE("channel disconnects when the last clone is dropped",
+          "[lx::sync::channel]") {
+    auto [tx, rx] = channel<i32>(4);
+    {
+        auto clone = tx;
+        auto moved = std::move(tx);
+        REQUIRE(!rx.is_disconnected());
+    }
+    REQUIRE(rx.is_disconnected());
+}
+
+TEST_CASE("channel drops queued values", "[lx::sync::channel]") {
+    Counted::live = 0;
+    {
+        auto [tx, rx] = channel<Counted>(4);
+        REQUIRE(tx.try_send(Counted(1)).is_ok());
+        REQUIRE(tx.try_send(Counted(2)).is_ok());
+        REQUIRE(Counted::live == 2);
+
+        REQUIRE(rx.try_recv().unwrap().value == 1);
+        REQUIRE(Counted::live == 1);
+    }
+    REQUIRE(Counted::live == 0);
+}
+
+TEST_CASE("channel blocking recv wakes on send", "[lx::sync::channel]") {
+    auto [tx, rx] = channel<i32>(2);
+
+    auto sum = 0;
+    auto consumer = std::thread([receiver = std::move(rx), &sum]() mutable {
+        while (auto value = receiver.recv()) sum += value.unwrap();
+    });
+
+    for (auto i = 0; i < 100; i++) REQUIRE(tx.send(i).is_ok());
+    {
+        auto dropped = std::move(tx);
+    }
+    consumer.join();
+    REQUIRE(sum == 4950);
+}
+
+TEST_CASE("channel blocking send wakes on disconnect",
+          "[lx::sync::channel]") {
+    auto [tx, rx] = channel<i32>(2);
+    REQUIRE(tx.try_send(1).is_ok());
+    REQUIRE(tx.try_send(2).is_ok());
+
+    auto failed = false;
+    auto producer = std::thread([sender = std::move(tx), &failed]() mutable {
+        failed = sender.send(3).is_err();
+    });
+
+    // Let the producer block on the full channel
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+        auto dropped = std::move(rx);
+    }
+    producer.join();
+    REQUIRE(failed);
+}
+
+TEST_CASE("channel delivers every value exactly once",
+          "[lx::sync::channel]") {
+    constexpr auto producers = 4;
+    constexpr auto consumers = 4;
+    constexpr auto per_producer = u64{10000};
+
+    auto [tx, rx] = channel<u64>(64);
+    auto total = std::atomic<u64>(0);
+    auto received = std::atomic<u64>(0);
+    auto failures = std::atomic<u64>(0);
+    auto threads = std::vector<std::thread>();
+
+    for (auto p = 0; p < producers; p++) {
+        threads.emplace_back([sender = tx, &failures]() mutable {
+            for (auto i = u64{1}; i <= per_producer; i++)
+                if (sender.send(i).is_err()) failures.fetch_add(1);
+        });
+    }
+
+    for (auto c = 0; c < consumers; c++) {
+        threads.emplace_back([receiver = rx, &total, &received]() mutable {
+            while (auto value = receiver.recv()) {
+                total.fetch_add(value.unwrap());
+                received.fetch_add(1);
+            }
+        });
+    }
+
+    {
+        auto dropped_tx = std::move(tx);
+        auto dropped_rx = std::move(rx);
+    }
+    for (auto& thread : threads) thread.join();
+
+    REQUIRE(failures.load() == 0);
+    REQUIRE(received.load() == producers * per_producer);
+    REQUIRE(total.load() ==
+            producers * per_producer * (per_producer + 1) / 2);
+}
+
+TEST_CASE("spsc_channel keeps order", "[lx::sync::spsc_channel]") {
+    constexpr auto count = u64{100000};
+
+    auto [tx, rx] = spsc_channel<u64>(16);
+
+    auto producer = std::thread([sender = std::move(tx)]() mutable {
+        for (auto i = u64{0}; i < count; i++)
+            if (sender.send(i).is_err()) return;
+    });
+
+    auto expected = u64{0};
+    auto in_order = true;
+    while (auto value = rx.recv()) in_order &= value.unwrap() == expected++;
+
+    producer.join();
+    REQUIRE(in_order);
+    REQUIRE(expected == count);
+}
+
+TEST_CASE("spsc_channel try_send reports full",
+          "[lx::sync::spsc_channel]") {
+    auto [tx, rx] = spsc_channel<i32>(2);
+    REQUIRE(tx.try_send(1).is_ok());
+    REQUIRE(tx.try_send(2).is_ok());
+    REQUIRE(tx.try_send(3).unwrap_err().is_full());
+
+    REQUIRE(rx.try_recv().unwrap() == 1);
+    REQUIRE(tx.try_send(3).is_ok());
+}
+
+static_assert(std::copy_constructible<Sender<i32>>);
+static_assert(std::copy_constructible<Receiver<i32>>);
+static_assert(!std::copy_constructible<SpscSender<i32>>);
+static_assert(!std::copy_constructible<SpscReceiver<i32>>);
+static_assert(lx::trait::Send<Sender<i32>>);
@@ -0,0 +1,72 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/arc.hpp"
+#include "lastix/core/rc.hpp"
+#include "lastix/sync/mutex.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace lx::core;
+using namespace lx::sync;
+
+TEST_CASE("Mutex lock gives access to the value", "[lx::sync::Mutex]") {
+    auto mutex = Mutex<i32>(1);
+    {
+        auto guard = mutex.lock();
+        REQUIRE(mutex.is_locked());
+        REQUIRE(*guard == 1);
+        *guard = 2;
+    }
+    REQUIRE(!mutex.is_locked());
+    REQUIRE(*mutex.lock() == 2);
+}
+
+TEST_CASE("Mutex try_lock fails while locked", "[lx::sync::Mutex]") {
+    auto mutex = Mutex<i32>(1);
+    {
+        auto guard = mutex.lock();
+        REQUIRE(mutex.try_lock().is_none());
+    }
+
+    auto guard = mutex.try_lock();
+    REQUIRE(guard.is_some());
+    REQUIRE(*guard.unwrap() == 1);
+    REQUIRE(!mutex.is_locked());
+}
+
+TEST_CASE("Mutex guard moves keep one unlock", "[lx::sync::Mutex]") {
+    auto mutex = Mutex<i32>(1);
+    {
+        auto guard = mutex.lock();
+        auto moved = std::move(guard);
+        REQUIRE(mutex.is_locked());
+    }
+    REQUIRE(!mutex.is_locked());
+}
+
+TEST_CASE("Mutex into_inner", "[lx::sync::Mutex]") {
+    auto mutex = Mutex<std::vector<i32>>(usize{3}, 7);
+    auto values = std::move(mutex).into_inner();
+    REQUIRE(values.size() == 3);
+}
+
+TEST_CASE("Mutex serializes increments", "[lx::sync::Mutex]") {
+    constexpr auto threads = 8;
+    constexpr auto increments = 10000;
+
+    auto counter = Arc<Mutex<u64>>(u64{0});
+    {
+        auto workers = std::vector<std::jthread>();
+        for (auto t = 0; t < threads; t++) {
+            workers.emplace_back([counter] mutable {
+                for (auto i = 0; i < increments; i++) (*counter->lock())++;
+            });
+        }
+    }
+
+    REQUIRE(*counter->lock() == threads * increments);
+}
+
+static_assert(lx::trait::Sync<Mutex<i32>>);
+static_assert(!lx::trait::Sync<Mutex<Rc<i32>>>);
+static_assert(!lx::trait::Send<MutexGuard<i32>>);
@@ -0,0 +1,97 @@
+#include "catch2/catch_test_macros.hpp"
+#include "lastix/core/arc.hpp"
+#include "lastix/sync/rwlock.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace lx::core;
+using namespace lx::sync;
+
+TEST_CASE("RwLock readers share the lock", "[lx::sync::RwLock]") {
+    auto lock = RwLock<i32>(5);
+
+    auto first = lock.read();
+    auto second = lock.try_read();
+    REQUIRE(second.is_some());
+    REQUIRE(*first == 5);
+    REQUIRE(lock.try_write().is_none());
+}
+
+TEST_CASE("RwLock writer excludes everyone", "[lx::sync::RwLock]") {
+    auto lock = RwLock<i32>(5);
+    {
+        auto writer = lock.write();
+        *writer = 6;
+        REQUIRE(lock.try_read().is_none());
+        REQUIRE(lock.try_write().is_none());
+    }
+
+    REQUIRE(*lock.read() == 6);
+    REQUIRE(lock.try_write().is_some());
+}
+
+TEST_CASE("RwLock read guards from other threads block writers",
+          "[lx::sync::RwLock]") {
+    auto lock = RwLock<i32>(0);
+    auto reading = std::atomic<bool>(false);
+    auto release = std::atomic<bool>(false);
+
+    auto reader = std::jthread([&] {
+        auto guard = lock.read();
+        reading.store(true);
+        while (!release.load()) std::this_thread::yield();
+    });
+
+    while (!reading.load()) std::this_thread::yield();
+    REQUIRE(lock.try_write().is_none());
+
+    release.store(true);
+    reader.join();
+    REQUIRE(lock.try_write().is_some());
+}
+
+TEST_CASE("RwLock keeps invariants under contention", "[lx::sync::RwLock]") {
+    struct Pair {
+            u64 a = 0;
+            u64 b = 0;
+    };
+
+    constexpr auto writes = 2000;
+
+    auto lock = Arc<RwLock<Pair>>();
+    auto torn = std::atomic<u64>(0);
+    auto done = std::atomic<bool>(false);
+    {
+        auto readers = std::vector<std::jthread>();
+        for (auto t = 0; t < 4; t++) {
+            readers.emplace_back([lock, &torn, &done] mutable {
+                while (!done.load()) {
+                    auto guard = lock->read();
+                    if (guard->a != guard->b) torn.fetch_add(1);
+                }
+            });
+        }
+
+        auto writers = std::vector<std::jthread>();
+        for (auto t = 0; t < 2; t++) {
+            writers.emplace_back([lock] mutable {
+                for (auto i = 0; i < writes; i++) {
+                    auto guard = lock->write();
+                    guard->a++;
+                    guard->b++;
+                }
+            });
+        }
+
+        for (auto& writer : writers) writer.join();
+        done.store(true);
+    }
+
+    REQUIRE(torn.load() == 0);
+    REQUIRE(lock->read()->a == 2 * writes);
+}
+
+static_assert(lx::trait::Sync<RwLock<i32>>);
+static_assert(!lx::trait::Send<RwLockReadGuard<i32>>);